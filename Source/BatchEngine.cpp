@@ -0,0 +1,302 @@
+/*
+  ==============================================================================
+
+    BatchEngine.cpp
+
+  ==============================================================================
+*/
+
+#include "BatchEngine.h"
+
+class BatchEngine::Worker : public juce::Thread
+{
+public:
+    Worker (BatchEngine& owner, int index)
+        : juce::Thread ("BatchEngine worker " + juce::String (index)), owner (owner), index (index) {}
+
+    void run() override
+    {
+        for (;;) {
+            wait (-1); // runWorkers()かstopThread()で起きる
+            if (threadShouldExit()) return;
+
+            owner.runItems (owner.scratchBuffers[(size_t) index].data());
+            if (--owner.remainingWorkers == 0) owner.workersFinished.signal();
+        }
+    }
+
+private:
+    BatchEngine& owner;
+    const int index;
+};
+
+BatchEngine::BatchEngine (double sampleRate, int maxBlockSize, float delayTimeMax, float roomSizeMax,
+                          MultiTapDelay::Quality quality, int numThreads)
+    : sampleRate (sampleRate),
+      maxBlockSize (juce::jmax (1, maxBlockSize)),
+      quality (quality)
+{
+    tapTableCompiler.setSampleRate ((float) sampleRate);
+    crossfadeLength = MultiTapDelay::getCrossfadeLength ((float) sampleRate);
+
+    // 一番遠いタップ(+補間分) + 1ブロック書いても読み出し範囲を潰さないサイズ
+    auto maxTable = tapTableCompiler.compileTapTable (delayTimeMax, roomSizeMax);
+    historySize = *std::max_element (maxTable.samples.begin(), maxTable.samples.end()) + 2 + this->maxBlockSize;
+
+    scratchBuffers.resize ((size_t) juce::jmax (1, numThreads));
+    for (auto& scratch : scratchBuffers)
+        scratch.resize ((size_t) ((laneChunk + 1) * this->maxBlockSize));
+
+    // scratchBuffers[0]は呼んだthreadが使う
+    for (int index = 1; index < (int) scratchBuffers.size(); ++index) {
+        workers.push_back (std::make_unique<Worker> (*this, index));
+        workers.back()->startThread();
+    }
+}
+
+BatchEngine::~BatchEngine()
+{
+    for (auto& worker : workers)
+        worker->stopThread (1000);
+}
+
+//==============================================================================
+int BatchEngine::addStream (int numChannels, const StreamParameters& parameters)
+{
+    Stream stream { (int) laneGroup.size(), juce::jlimit (1, 2, numChannels) };
+    for (int channel = 0; channel < stream.numChannels; ++channel) {
+        auto group = acquireGroup (parameters.delayTime, parameters.roomSize);
+        groups[(size_t) group].lanes.push_back ((int) laneGroup.size());
+        laneGroup.push_back (group);
+        lanePreviousGroup.push_back (-1);
+        laneCrossfadeCounter.push_back (0);
+        laneMix.push_back (parameters.mix / 100.0f);
+        laneVolume.push_back (parameters.volume);
+        laneLinear.push_back (parameters.linear ? 1 : 0);
+        laneStream.push_back ((int) streams.size());
+        laneChannel.push_back (channel);
+    }
+    if (quality == MultiTapDelay::QUALITY_REALTIME) historyFloat.resize (laneGroup.size() * (size_t) historySize, 0.0f);
+    else historyDouble.resize (laneGroup.size() * (size_t) historySize, 0.0);
+    streams.push_back (stream);
+    workItemsDirty = true;
+    return (int) streams.size() - 1;
+}
+
+// MultiTapDelay::switchTapTable()と同じ: 今のtap tableから新しいtap tableへクロスフェードし直す
+void BatchEngine::setParameters (int streamIndex, const StreamParameters& parameters)
+{
+    if (! juce::isPositiveAndBelow (streamIndex, (int) streams.size())) return;
+
+    const auto& stream = streams[(size_t) streamIndex];
+    for (int lane = stream.firstLane; lane < stream.firstLane + stream.numChannels; ++lane) {
+        laneMix[(size_t) lane] = parameters.mix / 100.0f;
+        laneVolume[(size_t) lane] = parameters.volume;
+        laneLinear[(size_t) lane] = parameters.linear ? 1 : 0;
+
+        auto current = laneGroup[(size_t) lane];
+        const auto& table = groups[(size_t) current].tapTable;
+        if (table.delayTime == parameters.delayTime && table.roomSize == parameters.roomSize) continue;
+
+        // laneの参照: 今のgroupはクロスフェード元として残り, 前のクロスフェード元は手放す
+        auto group = acquireGroup (parameters.delayTime, parameters.roomSize);
+        auto& currentLanes = groups[(size_t) current].lanes;
+        currentLanes.erase (std::find (currentLanes.begin(), currentLanes.end(), lane));
+        groups[(size_t) group].lanes.push_back (lane);
+        if (lanePreviousGroup[(size_t) lane] >= 0) releaseGroup (lanePreviousGroup[(size_t) lane]);
+        laneGroup[(size_t) lane] = group;
+        lanePreviousGroup[(size_t) lane] = current;
+        laneCrossfadeCounter[(size_t) lane] = crossfadeLength;
+        workItemsDirty = true;
+    }
+}
+
+// 同じdelayTime/roomSizeのgroupがあれば共有, 無ければ空いているgroupを使い回して作る
+int BatchEngine::acquireGroup (float delayTime, float roomSize)
+{
+    auto key = std::make_pair (delayTime, roomSize);
+    auto found = groupIndex.find (key);
+    if (found != groupIndex.end()) {
+        groups[(size_t) found->second].numUsers++;
+        return found->second;
+    }
+
+    int group;
+    if (! freeGroups.empty()) {
+        group = freeGroups.back();
+        freeGroups.pop_back();
+    }
+    else {
+        group = (int) groups.size();
+        groups.emplace_back();
+    }
+    groups[(size_t) group].tapTable = tapTableCompiler.compileTapTable (delayTime, roomSize);
+    groups[(size_t) group].numUsers = 1;
+    groupIndex[key] = group;
+    return group;
+}
+
+void BatchEngine::releaseGroup (int group)
+{
+    auto& g = groups[(size_t) group];
+    if (--g.numUsers > 0) return;
+
+    jassert (g.lanes.empty());
+    groupIndex.erase (std::make_pair (g.tapTable.delayTime, g.tapTable.roomSize));
+    freeGroups.push_back (group);
+}
+
+void BatchEngine::rebuildWorkItems()
+{
+    workItems.clear();
+    for (int group = 0; group < (int) groups.size(); ++group) {
+        auto numLanes = (int) groups[(size_t) group].lanes.size();
+        for (int begin = 0; begin < numLanes; begin += laneChunk)
+            workItems.push_back ({ group, begin, juce::jmin (numLanes, begin + laneChunk) });
+    }
+    workItemsDirty = false;
+}
+
+//==============================================================================
+void BatchEngine::process (juce::AudioBuffer<float>* const* buffers, int numSamples)
+{
+    if (numSamples <= 0 || streams.empty()) return;
+
+    if (workItemsDirty) rebuildWorkItems();
+    for (int startSample = 0; startSample < numSamples; startSample += maxBlockSize)
+        processChunk (buffers, startSample, juce::jmin (maxBlockSize, numSamples - startSample));
+}
+
+void BatchEngine::processChunk (juce::AudioBuffer<float>* const* buffers, int startSample, int numSamples)
+{
+    runWorkers (buffers, startSample, numSamples);
+
+    writePos += numSamples;
+    if (writePos >= historySize) writePos -= historySize;
+
+    // クロスフェードが終わったlaneは古いgroupを手放す
+    for (size_t lane = 0; lane < laneCrossfadeCounter.size(); ++lane) {
+        if (lanePreviousGroup[lane] < 0) continue;
+        laneCrossfadeCounter[lane] = juce::jmax (0, laneCrossfadeCounter[lane] - numSamples);
+        if (laneCrossfadeCounter[lane] == 0) {
+            releaseGroup (lanePreviousGroup[lane]);
+            lanePreviousGroup[lane] = -1;
+        }
+    }
+}
+
+// 呼んだthreadも含めて, 仕事が無くなるまでworkItemsを1つずつ取る
+// 起こすworkerは仕事の数まで, 残りは寝たまま
+void BatchEngine::runWorkers (juce::AudioBuffer<float>* const* buffers, int startSample, int numSamples)
+{
+    chunkBuffers = buffers;
+    chunkStartSample = startSample;
+    chunkNumSamples = numSamples;
+    nextItem = 0;
+
+    const auto numWorkers = juce::jlimit (0, (int) workers.size(), (int) workItems.size() - 1);
+    remainingWorkers = numWorkers;
+    for (int worker = 0; worker < numWorkers; ++worker)
+        workers[(size_t) worker]->notify();
+
+    runItems (scratchBuffers[0].data());
+    if (numWorkers > 0) workersFinished.wait();
+}
+
+void BatchEngine::runItems (double* scratch)
+{
+    for (int item = nextItem++; item < (int) workItems.size(); item = nextItem++) {
+        if (quality == MultiTapDelay::QUALITY_REALTIME)
+            processItem (historyFloat, workItems[(size_t) item], chunkBuffers, chunkStartSample, chunkNumSamples, scratch);
+        else
+            processItem (historyDouble, workItems[(size_t) item], chunkBuffers, chunkStartSample, chunkNumSamples, scratch);
+    }
+}
+
+//==============================================================================
+template <typename HistoryType>
+void BatchEngine::processItem (std::vector<HistoryType>& history, const WorkItem& item, juce::AudioBuffer<float>* const* buffers,
+                               int startSample, int numSamples, double* scratch)
+{
+    const auto& group = groups[(size_t) item.group];
+    const int* lanes = group.lanes.data() + item.laneBegin;
+    const int numLanes = item.laneEnd - item.laneBegin;
+
+    auto getBuffer = [this, buffers] (int lane) { return buffers[laneStream[(size_t) lane]]; };
+
+    // 入力をhistoryに書く (writePosは全lane共通)
+    for (int l = 0; l < numLanes; ++l) {
+        auto* buffer = getBuffer (lanes[l]);
+        auto* in = buffer != nullptr ? buffer->getReadPointer (laneChannel[(size_t) lanes[l]], startSample) : nullptr;
+        auto threshold = MultiTapDelay::getInputThreshold (quality, laneLinear[(size_t) lanes[l]] != 0);
+        HistoryType* laneHistory = history.data() + (size_t) lanes[l] * (size_t) historySize;
+        for (int i = 0, pos = writePos; i < numSamples; i++) {
+            float tmp = in != nullptr ? in[i] : 0.0f;
+            if (std::abs (tmp) < threshold) tmp = 0;
+            laneHistory[pos] = tmp;
+            if (++pos == historySize) pos = 0;
+        }
+    }
+
+    accumulate (history, group.tapTable, lanes, numLanes, numSamples, scratch);
+
+    double* previousAccumulator = scratch + laneChunk * maxBlockSize;
+    for (int l = 0; l < numLanes; ++l) {
+        const int lane = lanes[l];
+        double* acc = scratch + l * numSamples;
+
+        // group移動から50msは古いtap tableからクロスフェード
+        auto previous = lanePreviousGroup[(size_t) lane];
+        if (previous >= 0) {
+            accumulate (history, groups[(size_t) previous].tapTable, &lane, 1, numSamples, previousAccumulator);
+            for (int i = 0, counter = laneCrossfadeCounter[(size_t) lane]; i < numSamples && counter > 0; i++, counter--)
+                acc[i] = MultiTapDelay::crossfade<float> (acc[i], previousAccumulator[i], counter, crossfadeLength);
+        }
+
+        auto* buffer = getBuffer (lane);
+        if (buffer == nullptr) continue;
+        float* out = buffer->getWritePointer (laneChannel[(size_t) lane], startSample);
+        const float mix = laneMix[(size_t) lane];
+        const float volume = laneVolume[(size_t) lane];
+        const bool linear = laneLinear[(size_t) lane] != 0;
+        for (int i = 0; i < numSamples; i++) {
+            auto tmp = MultiTapDelay::clipWet ((float) acc[i], linear);
+            out[i] = MultiTapDelay::mixOutput (out[i], tmp, mix, volume);
+        }
+    }
+}
+
+// タップの位置と音量はtableから1回だけ読み, laneList全部に加算する (加算順はMultiTapDelayと同じ)
+template <typename HistoryType>
+void BatchEngine::accumulate (const std::vector<HistoryType>& history, const MultiTapDelay::TapTable& table,
+                              const int* laneList, int count, int numSamples, double* dst) const
+{
+    std::fill (dst, dst + count * numSamples, 0.0);
+
+    auto addTap = [&] (int tapSample, float tapVolume)
+    {
+        int readPos = writePos - tapSample;
+        if (readPos < 0) readPos += historySize;
+        const int run1 = juce::jmin (numSamples, historySize - readPos);
+        for (int l = 0; l < count; ++l) {
+            const HistoryType* src = history.data() + (size_t) laneList[l] * (size_t) historySize;
+            double* acc = dst + l * numSamples;
+            MultiTapDelay::accumulateRun<1, float> (src + readPos, &tapVolume, acc, run1);
+            MultiTapDelay::accumulateRun<1, float> (src, &tapVolume, acc + run1, numSamples - run1);
+        }
+    };
+
+    for (int j = 0; j < MultiTapDelay::numTaps; j++) {
+        if (quality == MultiTapDelay::QUALITY_REALTIME) {
+            addTap (table.samples[(size_t) j], table.volumes[(size_t) j]);
+        }
+        else {
+            // 1サンプル古い方と線形補間
+            float nearVolume, farVolume;
+            MultiTapDelay::splitTapVolume (table.volumes[(size_t) j], table.fractions[(size_t) j], nearVolume, farVolume);
+            addTap (table.samples[(size_t) j], nearVolume);
+            if (table.fractions[(size_t) j] > 0.0f)
+                addTap (table.samples[(size_t) j] + 1, farVolume);
+        }
+    }
+}
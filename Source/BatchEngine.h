@@ -0,0 +1,126 @@
+/*
+  ==============================================================================
+
+    BatchEngine.h
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+#include "MultiTapDelay.h"
+
+// サーバー用: 多数のmono/stereoストリームを1つのプロセスでまとめて処理する
+// - 状態はstructure-of-arrays (チャンネル1本 = lane), historyは全laneで1つの配列, writePosも全laneで共通
+// - delayTime/roomSizeが同じストリームは同じtap tableのgroupにまとめ, タップごとの位置と音量は1回だけ読む
+// - groupをlaneChunk本ずつに分けた仕事を, 空いたthreadがatomicなカウンタから順に取っていく
+// 1サンプルの計算はMultiTapDelayの共通関数と同じ (入力の閾値, 補間, クロスフェード, クリップ, mix)
+// 出力はフェード/ゲートを使わないMultiTapDelay (パラメータ変更 = switchTapTable()) と同じになる
+// delayTime/roomSizeの変更は次のprocess()から新しいgroupに移り, 古いtap tableから50msクロスフェードする
+class BatchEngine
+{
+public:
+    struct StreamParameters
+    {
+        float delayTime = 15.0f;
+        float roomSize = 30.0f;
+        float mix = 100.0f;   // 0~100
+        float volume = 1.0f;
+        bool linear = false;  // MultiTapDelay::setLinear()
+    };
+
+    BatchEngine (double sampleRate, int maxBlockSize, float delayTimeMax, float roomSizeMax,
+                 MultiTapDelay::Quality quality = MultiTapDelay::QUALITY_REALTIME,
+                 int numThreads = juce::SystemStats::getNumCpus());
+    ~BatchEngine();
+
+    //------------------------------------------------------------------------
+    // process()と同時には呼ばない
+    int addStream (int numChannels, const StreamParameters& parameters);
+    void setParameters (int stream, const StreamParameters& parameters);
+    int getNumStreams() const { return (int) streams.size(); }
+    int getNumGroups() const { return (int) groupIndex.size(); } // 使われているgroupの数
+
+    // buffers[stream]をその場で処理する (nullptrのストリームは無音として扱う)
+    // maxBlockSizeより長いブロックはmaxBlockSizeずつに分けて処理する
+    void process (juce::AudioBuffer<float>* const* buffers, int numSamples);
+
+private:
+    struct Stream
+    {
+        int firstLane;
+        int numChannels;
+    };
+    // numUsers : このgroupにいるlane + このgroupからクロスフェード中のlane, 0になったら空きにして使い回す
+    struct Group
+    {
+        MultiTapDelay::TapTable tapTable;
+        std::vector<int> lanes;
+        int numUsers = 0;
+    };
+    struct WorkItem
+    {
+        int group;
+        int laneBegin;
+        int laneEnd;
+    };
+
+    int acquireGroup (float delayTime, float roomSize);
+    void releaseGroup (int group);
+    void rebuildWorkItems();
+    void processChunk (juce::AudioBuffer<float>* const* buffers, int startSample, int numSamples);
+    void runWorkers (juce::AudioBuffer<float>* const* buffers, int startSample, int numSamples);
+    void runItems (double* scratch);
+    template <typename HistoryType>
+    void processItem (std::vector<HistoryType>& history, const WorkItem& item, juce::AudioBuffer<float>* const* buffers,
+                      int startSample, int numSamples, double* scratch);
+    template <typename HistoryType>
+    void accumulate (const std::vector<HistoryType>& history, const MultiTapDelay::TapTable& table,
+                     const int* laneList, int count, int numSamples, double* dst) const;
+
+    static constexpr int laneChunk = 16;
+
+    double sampleRate;
+    int maxBlockSize;
+    int historySize;
+    int writePos = 0;
+    int crossfadeLength;
+    MultiTapDelay::Quality quality;
+    MultiTapDelay tapTableCompiler;
+
+    std::vector<Stream> streams;
+    std::vector<Group> groups;
+    std::vector<int> freeGroups;
+    std::map<std::pair<float, float>, int> groupIndex;
+
+    // lane (チャンネル) ごとの状態
+    std::vector<float> historyFloat;     // lane * historySize, QUALITY_REALTIME
+    std::vector<double> historyDouble;   // lane * historySize, QUALITY_OFFLINE
+    std::vector<int> laneGroup;
+    std::vector<int> lanePreviousGroup;  // クロスフェード中だけ >= 0
+    std::vector<int> laneCrossfadeCounter;
+    std::vector<float> laneMix;
+    std::vector<float> laneVolume;
+    std::vector<char> laneLinear;
+    std::vector<int> laneStream;
+    std::vector<int> laneChannel;
+
+    std::vector<WorkItem> workItems;
+    bool workItemsDirty = true;
+
+    // 1 thread = 1 scratch (laneChunk本分の加算用 + クロスフェード用)
+    std::vector<std::vector<double>> scratchBuffers;
+    std::atomic<int> nextItem { 0 };
+
+    // workerはコンストラクタで作ったまま待たせておき, チャンクごとにnotify()で起こす
+    // (process()の度にjobやstd::functionを作らない) チャンクの引数はnotify()の前に書いておく
+    class Worker;
+    std::vector<std::unique_ptr<Worker>> workers;
+    juce::AudioBuffer<float>* const* chunkBuffers = nullptr;
+    int chunkStartSample = 0;
+    int chunkNumSamples = 0;
+    std::atomic<int> remainingWorkers { 0 };
+    juce::WaitableEvent workersFinished;
+
+    JUCE_DECLARE_NON_COPYABLE (BatchEngine)
+};
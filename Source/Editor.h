@@ -23,6 +23,9 @@
 #include <JuceHeader.h>
 #include "PluginProcessor.h"
 #include "Knob.h"
+#include "EditorTimings.h"
+#include "RepaintCounter.h"
+#include "Visualiser.h"
 typedef juce::AudioProcessorValueTreeState::SliderAttachment KnobAttachment;
 
 //[/Headers]
@@ -38,6 +41,7 @@ typedef juce::AudioProcessorValueTreeState::SliderAttachment KnobAttachment;
                                                                     //[/Comments]
 */
 class Editor  : public juce::AudioProcessorEditor,
+                public juce::ChangeListener,
                 public juce::Slider::Listener
 {
 public:
@@ -47,16 +51,13 @@ public:
 
     //==============================================================================
     //[UserMethods]     -- You can add your own custom methods in this section.
+    void changeListenerCallback (juce::ChangeBroadcaster* source) override;
     //[/UserMethods]
 
     void paint (juce::Graphics& g) override;
     void resized() override;
     void sliderValueChanged (juce::Slider* sliderThatWasMoved) override;
 
-    // Binary resources:
-    static const char* bg_png;
-    static const int bg_pngSize;
-
 
 private:
     //[UserVariables]   -- You can add your own custom variables in this section.
@@ -68,6 +69,16 @@ private:
     std::unique_ptr<KnobAttachment> roomSizeAttachment;
     std::unique_ptr<KnobAttachment> mixAttachment;
     std::unique_ptr<KnobAttachment> volumeAttachment;
+
+    // bg_png as an opaque layer buffered to an image, pre-scaled by EditorAssets
+    class Background : public juce::Component
+    {
+    public:
+        Background();
+        void paint (juce::Graphics& g) override;
+    };
+    Background background;
+    Visualiser visualiser;
     //[/UserVariables]
 
     //==============================================================================
@@ -75,7 +86,6 @@ private:
     std::unique_ptr<juce::Slider> mixKnob;
     std::unique_ptr<juce::Slider> roomSizeKnob;
     std::unique_ptr<juce::Slider> delayTimeKnob;
-    juce::Image cachedImage_bg_png_1;
 
 
     //==============================================================================
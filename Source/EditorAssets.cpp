@@ -0,0 +1,99 @@
+/*
+  ==============================================================================
+
+    EditorAssets.cpp
+
+  ==============================================================================
+*/
+
+#include "EditorAssets.h"
+#include "EditorTimings.h"
+#include "Resources.h"
+
+JUCE_IMPLEMENT_SINGLETON (EditorAssets)
+
+constexpr float EditorAssets::snapScales[];
+
+EditorAssets::EditorAssets()
+    : juce::Thread ("EditorAssets decoder")
+{
+    startThread();
+}
+
+EditorAssets::~EditorAssets()
+{
+    stopThread (2000);
+    cancelPendingUpdate();
+    clearSingletonInstance();
+}
+
+void EditorAssets::run()
+{
+    auto start = juce::Time::getMillisecondCounterHiRes();
+    backgroundImage = juce::ImageFileFormat::loadFrom (Resources::bg_png, (size_t) Resources::bg_pngSize);
+    knobImage = juce::ImageFileFormat::loadFrom (Resources::knob_png, (size_t) Resources::knob_pngSize);
+    EditorTimings::setDecode (juce::Time::getMillisecondCounterHiRes() - start);
+
+    loaded = true;
+    triggerAsyncUpdate();
+}
+
+void EditorAssets::handleAsyncUpdate()
+{
+    sendChangeMessage();
+}
+
+const juce::Image& EditorAssets::getBackground (float scale)
+{
+    if (! isLoaded())
+        return notLoaded;
+
+    return backgrounds.get (scale, [this] (float s) { return renderBackground (s); });
+}
+
+const juce::Image& EditorAssets::getKnobFilmstrip (float scale)
+{
+    if (! isLoaded())
+        return notLoaded;
+
+    return knobFilmstrips.get (scale, [this] (float s) { return renderKnobFilmstrip (s); });
+}
+
+int EditorAssets::getKnobFrameIndex (float angle) const
+{
+    auto frame = juce::roundToInt (angle / juce::MathConstants<float>::twoPi * (float) numKnobFrames);
+    return ((frame % numKnobFrames) + numKnobFrames) % numKnobFrames;
+}
+
+juce::Image EditorAssets::renderBackground (float scale) const
+{
+    auto w = juce::roundToInt (backgroundWidth * scale);
+    auto h = juce::roundToInt (backgroundHeight * scale);
+    juce::Image image (juce::Image::RGB, w, h, false);
+
+    juce::Graphics g (image);
+    g.setImageResamplingQuality (juce::Graphics::highResamplingQuality);
+    g.drawImage (backgroundImage, juce::Rectangle<float> ((float) w, (float) h));
+    return image;
+}
+
+juce::Image EditorAssets::renderKnobFilmstrip (float scale) const
+{
+    auto frameW = juce::roundToInt (knobImage.getWidth() * scale);
+    auto frameH = juce::roundToInt (knobImage.getHeight() * scale);
+    juce::Image strip (juce::Image::ARGB, frameW, frameH * numKnobFrames, true);
+
+    juce::Graphics g (strip);
+    g.setImageResamplingQuality (juce::Graphics::highResamplingQuality);
+    for (int i = 0; i < numKnobFrames; i++)
+    {
+        auto angle = juce::MathConstants<float>::twoPi * (float) i / (float) numKnobFrames;
+        juce::Graphics::ScopedSaveState state (g);
+        g.reduceClipRegion (0, i * frameH, frameW, frameH);
+        g.drawImageTransformed (knobImage, juce::AffineTransform::scale ((float) frameW / knobImage.getWidth(),
+                                                                         (float) frameH / knobImage.getHeight())
+                                                                 .rotated (angle, frameW * 0.5f, frameH * 0.5f)
+                                                                 .translated (0.0f, (float) (i * frameH)));
+    }
+    return strip;
+}
@@ -0,0 +1,95 @@
+/*
+  ==============================================================================
+
+    EditorAssets.h
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+
+// 背景とknobのフィルムストリップを表示スケールごとに作って全エディタで共有する
+// スケールは決まった段階 (snapScales) に切り上げて作り, 描画側が実際のサイズに縮めて描く
+// リサイズのドラッグ中も段階をまたいだ時だけ作り直すので, 毎フレームのリサンプルは発生しない
+// PNGのデコードはプロセスで一度だけ, バックグラウンドスレッドで行う
+class EditorAssets : public juce::ChangeBroadcaster,
+                     public juce::DeletedAtShutdown,
+                     private juce::Thread,
+                     private juce::AsyncUpdater
+{
+public:
+    EditorAssets();
+    ~EditorAssets() override;
+
+    // デコードが終わるまではfalse, 終わったらchange messageで通知する
+    // 終わるまでget〜()は空のImageを返す
+    bool isLoaded() const { return loaded.load(); }
+
+    const juce::Image& getBackground (float scale);
+
+    // frame番号の画像がstripの(0, frame * frameHeight)から並ぶ, 高さはscale込みのピクセル数
+    const juce::Image& getKnobFilmstrip (float scale);
+    int getKnobFrameIndex (float angle) const;
+    int getKnobWidth() const  { return knobImage.getWidth(); }
+    int getKnobHeight() const { return knobImage.getHeight(); }
+
+    static constexpr int backgroundWidth = 340;
+    static constexpr int backgroundHeight = 403;
+    static constexpr int numKnobFrames = 128;
+
+    JUCE_DECLARE_SINGLETON (EditorAssets, false)
+
+private:
+    void run() override;
+    void handleAsyncUpdate() override;
+
+    // 表示スケール (エディタの拡大率 x ディスプレイのスケール) 以上で一番近い段階
+    static float snapScale (float scale)
+    {
+        for (auto snapped : snapScales)
+            if (scale <= snapped + 0.01f)
+                return snapped;
+        return snapScales[numSnapScales - 1];
+    }
+    static constexpr int numSnapScales = 8;
+    static constexpr float snapScales[numSnapScales] = { 0.5f, 0.75f, 1.0f, 1.25f, 1.5f, 2.0f, 3.0f, 4.0f };
+
+    // 最近使った段階だけ残す
+    class ScaledImageCache
+    {
+    public:
+        template <typename RenderFunction>
+        const juce::Image& get (float scale, RenderFunction&& render)
+        {
+            auto key = juce::roundToInt (snapScale (scale) * 100.0f);
+            for (auto it = entries.begin(); it != entries.end(); ++it)
+            {
+                if (it->first == key)
+                {
+                    entries.splice (entries.begin(), entries, it);
+                    return entries.front().second;
+                }
+            }
+
+            entries.emplace_front (key, render (key / 100.0f));
+            if (entries.size() > maxEntries)
+                entries.pop_back();
+            return entries.front().second;
+        }
+
+    private:
+        static constexpr size_t maxEntries = 4;
+        std::list<std::pair<int, juce::Image>> entries;
+    };
+
+    juce::Image renderBackground (float scale) const;
+    juce::Image renderKnobFilmstrip (float scale) const;
+
+    std::atomic<bool> loaded { false };
+    juce::Image backgroundImage;
+    juce::Image knobImage;
+    const juce::Image notLoaded;
+    ScaledImageCache backgrounds;
+    ScaledImageCache knobFilmstrips;
+};
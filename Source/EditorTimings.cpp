@@ -0,0 +1,13 @@
+/*
+  ==============================================================================
+
+    EditorTimings.cpp
+
+  ==============================================================================
+*/
+
+#include "EditorTimings.h"
+std::atomic<juce::int64> EditorTimings::numEditorOpens { 0 };
+std::atomic<juce::int64> EditorTimings::editorOpenMicroseconds { 0 };
+std::atomic<juce::int64> EditorTimings::maxEditorOpenMicroseconds { 0 };
+std::atomic<juce::int64> EditorTimings::decodeMicroseconds { 0 };
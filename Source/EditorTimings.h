@@ -0,0 +1,45 @@
+/*
+  ==============================================================================
+
+    EditorTimings.h
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+
+// 全エディタ共通のエディタを開く時間の計測 (コンストラクタにかかった時間), 画像のデコード時間
+// セッション読み込みでエディタをまとめて開くミキサー向けの確認用
+class EditorTimings
+{
+public:
+    static void addEditorOpen (double milliseconds)
+    {
+        auto microseconds = (juce::int64) (milliseconds * 1000.0);
+        numEditorOpens += 1;
+        editorOpenMicroseconds += microseconds;
+        auto previousMax = maxEditorOpenMicroseconds.load();
+        while (microseconds > previousMax && ! maxEditorOpenMicroseconds.compare_exchange_weak (previousMax, microseconds)) {}
+    }
+
+    static void setDecode (double milliseconds) { decodeMicroseconds = (juce::int64) (milliseconds * 1000.0); }
+
+    static juce::int64 getNumEditorOpens() { return numEditorOpens.load(); }
+    static double getEditorOpenMsTotal() { return (double) editorOpenMicroseconds.load() / 1000.0; }
+    static double getEditorOpenMsMax()   { return (double) maxEditorOpenMicroseconds.load() / 1000.0; }
+    static double getDecodeMs()          { return (double) decodeMicroseconds.load() / 1000.0; } // デコードが終わるまでは0
+
+    static void reset()
+    {
+        numEditorOpens = 0;
+        editorOpenMicroseconds = 0;
+        maxEditorOpenMicroseconds = 0;
+    }
+
+private:
+    static std::atomic<juce::int64> numEditorOpens;
+    static std::atomic<juce::int64> editorOpenMicroseconds;
+    static std::atomic<juce::int64> maxEditorOpenMicroseconds;
+    static std::atomic<juce::int64> decodeMicroseconds;
+};
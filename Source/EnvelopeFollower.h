@@ -0,0 +1,109 @@
+/*
+  ==============================================================================
+
+    EnvelopeFollower.h
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+
+// sidechainの音量でゲートを開閉する
+// chunkSampleごとに全チャンネルのpeakをまとめて取り, chunk単位でone-poleの立ち上がり/減衰を計算する
+// (1サンプルずつの分岐はしない, 開閉の位置はchunkの先頭に揃う)
+// threshold以上で開く, thresholdを下回ってからholdの間は開いたまま, その後に閉じる
+class EnvelopeFollower
+{
+public:
+    struct Event
+    {
+        int samplePosition;
+        bool open;
+    };
+
+    //------------------------------------------------------------------------
+    void prepare(double sampleRate, int maximumBlockSize)
+    {
+        this->sampleRate = sampleRate;
+        events.resize((size_t)(maximumBlockSize / chunkSize + 2));
+        reset();
+    }
+
+    void reset()
+    {
+        envelope = 0.0f;
+        holdRemaining = 0;
+        open = false;
+    }
+
+    // ms, dBで指定, 係数はchunk分まとめて減衰する量にしておく
+    void setParameters(float thresholdDecibels, float attackMs, float holdMs, float releaseMs)
+    {
+        threshold = juce::Decibels::decibelsToGain(thresholdDecibels);
+        attackCoefficient = getChunkCoefficient(attackMs);
+        releaseCoefficient = getChunkCoefficient(releaseMs);
+        holdSamples = (int)(holdMs / 1000.0f * sampleRate);
+    }
+
+    //------------------------------------------------------------------------
+    // audio thread, 開閉したサンプル位置をgetEvent()で順に読む
+    int process(const juce::AudioBuffer<float>& sidechain, int numSamples)
+    {
+        numEvents = 0;
+        const int numChannels = sidechain.getNumChannels();
+        for (int start = 0; start < numSamples; start += chunkSize) {
+            const int n = juce::jmin(chunkSize, numSamples - start);
+
+            float peak = 0.0f;
+            for (int channel = 0; channel < numChannels; ++channel) {
+                auto range = juce::FloatVectorOperations::findMinAndMax(sidechain.getReadPointer(channel, start), n);
+                peak = juce::jmax(peak, -range.getStart(), range.getEnd());
+            }
+
+            const float coefficient = peak > envelope ? attackCoefficient : releaseCoefficient;
+            envelope = peak + (envelope - peak) * coefficient;
+
+            if (envelope >= threshold) {
+                holdRemaining = holdSamples;
+                if (! open) addEvent(start, true);
+            }
+            else if (open) {
+                holdRemaining -= n;
+                if (holdRemaining <= 0) addEvent(start + n, false);
+            }
+        }
+        return numEvents;
+    }
+
+    const Event& getEvent(int index) const { return events[(size_t) index]; }
+    bool isOpen() const { return open; }
+
+    static constexpr int chunkSize = 32;
+
+private:
+    float getChunkCoefficient(float timeMs) const
+    {
+        const double samples = juce::jmax(1.0, timeMs / 1000.0 * sampleRate);
+        return (float) std::exp(-(double) chunkSize / samples);
+    }
+
+    void addEvent(int samplePosition, bool shouldOpen)
+    {
+        open = shouldOpen;
+        if (numEvents < (int) events.size()) events[(size_t) numEvents++] = { samplePosition, shouldOpen };
+    }
+
+    double sampleRate = 44100.0;
+    float threshold = 0.063f;
+    float attackCoefficient = 0.0f;
+    float releaseCoefficient = 0.0f;
+    int holdSamples = 0;
+
+    float envelope = 0.0f;
+    int holdRemaining = 0;
+    bool open = false;
+
+    std::vector<Event> events = std::vector<Event>(64);
+    int numEvents = 0;
+};
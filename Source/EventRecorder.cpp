@@ -0,0 +1,329 @@
+/*
+  ==============================================================================
+
+    EventRecorder.cpp
+
+  ==============================================================================
+*/
+
+#include "EventRecorder.h"
+
+#define EVENT_MAGIC 0x56454752 // "RGEV"
+#define EVENT_VERSION 1
+
+// 1ブロックで書く最大のRecord数 (BLOCK, BYPASS, TAP_TABLE, ゲートのイベント), 足りなければそのイベントだけ落ちる
+#define MAX_RECORDS_PER_BLOCK 64
+
+EventRecorder::EventRecorder()
+    : juce::Thread ("EventRecorder")
+{
+    lastFadeState.fill (-1);
+}
+
+EventRecorder::~EventRecorder()
+{
+    stop();
+}
+
+//==============================================================================
+bool EventRecorder::start (const juce::File& file, bool shouldRecordAudio)
+{
+    stop();
+
+    file.deleteFile();
+    auto output = std::make_unique<juce::FileOutputStream> (file);
+    if (output->failedToOpen())
+        return false;
+
+    const juce::uint32 header[2] = { EVENT_MAGIC, EVENT_VERSION };
+    output->write (header, sizeof (header));
+
+    // 一度確保したら残す (audio threadが書き込み中かもしれないので解放はデストラクタで), 書いた所しか読まないので0埋めしない
+    if (ring == nullptr)
+        ring.malloc (ringSize);
+
+    stream = std::move (output);
+    fifo.reset();
+    recordAudio = shouldRecordAudio;
+    blockDropped = false;
+    droppedBefore = false;
+    lastFadeState.fill (-1);
+    lastWidth = -1.0f;
+    numDroppedBlocks = 0;
+    recording = true;
+    startThread();
+    return true;
+}
+
+void EventRecorder::stop()
+{
+    if (! recording.exchange (false))
+        return;
+
+    stopThread (1000);
+    drain();
+    stream = nullptr;
+}
+
+juce::File EventRecorder::getUniqueFile (const juce::File& file)
+{
+    static const auto processToken = juce::String::toHexString (juce::Time::currentTimeMillis() ^ juce::Random::getSystemRandom().nextInt64());
+    static std::atomic<int> counter { 0 };
+    return file.getSiblingFile (file.getFileNameWithoutExtension() + "-" + processToken + "-" + juce::String (++counter)
+                                + file.getFileExtension());
+}
+
+//==============================================================================
+void EventRecorder::recordPrepare (double sampleRate, int maxBlockSize, int numChannels, int numLanes, float delayTimeMax, float roomSizeMax)
+{
+    if (! isRecording()) return;
+
+    blockDropped = false;
+    lastFadeState.fill (-1);
+    lastWidth = -1.0f;
+    write (RECORD_PREPARE, numChannels, numLanes, maxBlockSize, (float) sampleRate, delayTimeMax, roomSizeMax);
+}
+
+void EventRecorder::recordBlock (const juce::AudioBuffer<float>& buffer, int numChannels, float delayTime, float roomSize, float mix, float volume, int flags)
+{
+    if (! isRecording()) return;
+
+    // ブロックの途中で切れないように, 入りきる時だけ記録する
+    auto numSamples = buffer.getNumSamples();
+    auto numAudioChannels = recordAudio ? juce::jmin (numChannels, buffer.getNumChannels()) : 0;
+    auto required = (int) sizeof (Record) * (MAX_RECORDS_PER_BLOCK + numAudioChannels + maxChannels)
+                  + numAudioChannels * numSamples * (int) sizeof (float);
+    blockDropped = fifo.getFreeSpace() < required;
+    if (blockDropped) {
+        droppedBefore = true;
+        numDroppedBlocks++;
+        return;
+    }
+
+    write (RECORD_BLOCK, numChannels, flags | (droppedBefore ? BLOCK_DROPPED_BEFORE : 0), numSamples, delayTime, roomSize, mix, volume);
+    droppedBefore = false;
+
+    for (int channel = 0; channel < numAudioChannels; ++channel) {
+        write (RECORD_AUDIO, channel, 0, numSamples);
+        write (buffer.getReadPointer (channel), numSamples * (int) sizeof (float));
+    }
+}
+
+void EventRecorder::recordTapTable (float delayTime, float roomSize)
+{
+    if (! isRecording() || blockDropped) return;
+    write (RECORD_TAP_TABLE, 0, 0, 0, delayTime, roomSize);
+}
+
+void EventRecorder::recordGate (int samplePosition, bool open, bool retrigger)
+{
+    if (! isRecording() || blockDropped) return;
+    write (RECORD_GATE, 0, 0, samplePosition, open ? 1.0f : 0.0f, retrigger ? 1.0f : 0.0f);
+}
+
+void EventRecorder::recordBypass()
+{
+    if (! isRecording() || blockDropped) return;
+    write (RECORD_BYPASS, 0, 0, 0);
+}
+
+void EventRecorder::recordFadeStates (const std::vector<MultiTapDelay>& delay)
+{
+    if (! isRecording() || blockDropped) return;
+
+    for (int channel = 0; channel < juce::jmin ((int) delay.size(), maxChannels); ++channel) {
+        auto fadeState = delay[channel].getFadeState();
+        if (fadeState == lastFadeState[channel]) continue;
+        lastFadeState[channel] = fadeState;
+        write (RECORD_FADE, channel, 0, 0, (float) fadeState);
+    }
+}
+
+void EventRecorder::recordWidth (float width)
+{
+    if (! isRecording() || blockDropped || width == lastWidth) return;
+    lastWidth = width;
+    write (RECORD_WIDTH, 0, 0, 0, width);
+}
+
+//==============================================================================
+bool EventRecorder::write (const void* data, int numBytes)
+{
+    if (fifo.getFreeSpace() < numBytes) return false;
+
+    auto scope = fifo.write (numBytes);
+    auto* src = static_cast<const char*> (data);
+    memcpy (ring + scope.startIndex1, src, (size_t) scope.blockSize1);
+    memcpy (ring + scope.startIndex2, src + scope.blockSize1, (size_t) scope.blockSize2);
+    return true;
+}
+
+void EventRecorder::write (RecordType type, int channel, int flags, int numSamples, float v0, float v1, float v2, float v3)
+{
+    Record record { (juce::uint8) type, (juce::uint8) channel, (juce::uint16) flags, numSamples,
+                    juce::Time::getHighResolutionTicks(), { v0, v1, v2, v3 } };
+    write (&record, sizeof (record));
+}
+
+void EventRecorder::drain()
+{
+    if (stream == nullptr) return;
+
+    auto scope = fifo.read (fifo.getNumReady());
+    stream->write (ring + scope.startIndex1, (size_t) scope.blockSize1);
+    stream->write (ring + scope.startIndex2, (size_t) scope.blockSize2);
+    stream->flush();
+}
+
+void EventRecorder::run()
+{
+    while (! threadShouldExit()) {
+        drain();
+        wait (20);
+    }
+}
+
+//==============================================================================
+// PluginProcessor::resizeDelays()と同じ: stereoはdelay[0]のL/Rペア, それ以外はチャンネルごとに1つ
+// 数かlane数が変わったらtrue
+static bool resizeDelays (std::vector<MultiTapDelay>& delay, int numChannels)
+{
+    numChannels = juce::jmax (1, numChannels);
+    const auto numDelays = (size_t) (numChannels == 2 ? 1 : numChannels);
+    const auto numLanes = numChannels == 2 ? 2 : 1;
+    if (delay.size() == numDelays && delay[0].getNumLanes() == numLanes) return false;
+
+    delay.resize (numDelays);
+    for (auto& d : delay) d.setNumLanes (numLanes);
+    return true;
+}
+
+EventRecorder::ReplayResult EventRecorder::replay (const juce::File& file, std::function<void (const juce::AudioBuffer<float>&)> onBlock)
+{
+    ReplayResult result;
+    juce::FileInputStream input (file);
+    juce::uint32 header[2] = {};
+    if (input.failedToOpen() || input.read (header, sizeof (header)) != (int) sizeof (header)
+         || header[0] != EVENT_MAGIC || header[1] > EVENT_VERSION)
+        return result;
+    result.opened = true;
+
+    std::vector<MultiTapDelay> delay;
+    juce::AudioBuffer<float> buffer;
+    std::vector<Record> events;
+    Record prepare {};
+    Record block {};
+    bool hasBlock = false;
+
+    // processBlockと同じ順番で: パラメータ -> tap table / ゲート / bypass -> 処理 -> fadeStateの確認
+    auto processBlock = [&]()
+    {
+        if (! hasBlock) return;
+        hasBlock = false;
+
+        result.numBlocks++;
+        if (block.flags & BLOCK_DROPPED_BEFORE)
+            result.numDroppedGaps++;
+
+        // processBlockでチャンネル数が変わった時と同じく, 追加分はprepareせずに使う
+        if (resizeDelays (delay, block.channel)) {
+            for (auto& d : delay) {
+                d.setSampleRate (prepare.values[0]);
+                d.setRoomSizeMax (prepare.values[2]);
+                d.setDelayTimeMax (prepare.values[1]);
+            }
+        }
+
+        auto quality = (block.flags & BLOCK_QUALITY_OFFLINE) ? MultiTapDelay::QUALITY_OFFLINE : MultiTapDelay::QUALITY_REALTIME;
+        for (auto& d : delay) {
+            d.setQuality (quality);
+            d.setLinear ((block.flags & BLOCK_LINEAR) != 0);
+            if (d.getDelayTime() != block.values[0]) d.setDelayTime (block.values[0]);
+            if (d.getRoomSize() != block.values[1]) d.setRoomSize (block.values[1]);
+            if (d.getMix() != block.values[2]) d.setMix (block.values[2]);
+            if (d.getVolume() != block.values[3]) d.setVolume (block.values[3]);
+        }
+
+        auto numChannels = juce::jmin ((int) block.channel, buffer.getNumChannels());
+        auto numSamples = buffer.getNumSamples();
+        auto stereoPair = numChannels == 2 && delay[0].getNumLanes() == 2;
+        if (! stereoPair) numChannels = juce::jmin (numChannels, (int) delay.size());
+        auto processRange = [&] (int start, int end)
+        {
+            if (end <= start) return;
+            if (stereoPair) delay[0].processPair (buffer, start, end - start);
+            else for (int channel = 0; channel < numChannels; ++channel) delay[(size_t) channel].process (buffer, channel, start, end - start);
+        };
+
+        int startSample = 0;
+        bool bypassed = false;
+        for (auto& event : events) {
+            if (event.type == RECORD_TAP_TABLE) {
+                for (auto& d : delay) d.switchTapTable (d.compileTapTable (event.values[0], event.values[1]));
+            }
+            else if (event.type == RECORD_WIDTH) {
+                delay[0].setWidth (event.values[0]);
+            }
+            else if (event.type == RECORD_BYPASS) {
+                if (stereoPair)
+                    delay[0].pushHistory (buffer.getReadPointer (0), buffer.getReadPointer (1), numSamples);
+                else
+                    for (int channel = 0; channel < numChannels; ++channel)
+                        delay[(size_t) channel].pushHistory (buffer.getReadPointer (channel), numSamples);
+                bypassed = true;
+            }
+            else if (event.type == RECORD_GATE) {
+                auto eventSample = juce::jlimit (startSample, numSamples, (int) event.numSamples);
+                processRange (startSample, eventSample);
+                startSample = eventSample;
+                for (auto& d : delay) d.setGate (event.values[0] != 0.0f, event.values[1] != 0.0f);
+            }
+        }
+        if (! bypassed) processRange (startSample, numSamples);
+
+        bool mismatch = false;
+        for (auto& event : events) {
+            if (event.type == RECORD_FADE && (int) event.channel < (int) delay.size()
+                 && delay[event.channel].getFadeState() != (int) event.values[0])
+                mismatch = true;
+        }
+        if (mismatch && result.numFadeMismatches++ == 0)
+            result.firstMismatchTicks = block.ticks;
+        events.clear();
+
+        if (onBlock != nullptr) onBlock (buffer);
+    };
+
+    Record record;
+    while (input.read (&record, sizeof (record)) == (int) sizeof (record)) {
+        if (record.type == RECORD_PREPARE) {
+            processBlock();
+            prepare = record;
+            resizeDelays (delay, record.channel);
+            for (auto& d : delay) {
+                d.setRoomSizeMax (record.values[2]);
+                d.setDelayTimeMax (record.values[1]);
+                d.prepare (record.values[0], record.numSamples);
+            }
+        }
+        else if (record.type == RECORD_BLOCK) {
+            processBlock();
+            block = record;
+            hasBlock = true;
+            buffer.setSize (record.channel, record.numSamples);
+            buffer.clear();
+        }
+        else if (record.type == RECORD_AUDIO) {
+            auto numBytes = (int) record.numSamples * (int) sizeof (float);
+            if (hasBlock && record.channel < buffer.getNumChannels() && record.numSamples == buffer.getNumSamples())
+                input.read (buffer.getWritePointer (record.channel), numBytes);
+            else
+                input.skipNextBytes (numBytes);
+        }
+        else if (hasBlock) {
+            events.push_back (record);
+        }
+    }
+    processBlock();
+    return result;
+}
@@ -0,0 +1,115 @@
+/*
+  ==============================================================================
+
+    EventRecorder.h
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+#include "MultiTapDelay.h"
+
+// 本番で起きたグリッチを再現するための記録 (opt-in)
+// audio threadは確保済みのリングにRecordを書くだけ (wait-freeなSPSC FIFO), 専用threadがファイルに書き出す
+// ファイル形式 (native endian):
+//   "RGEV", version(uint32), 以降Recordが続く, RECORD_AUDIOの後にはnumSamples個のfloatが続く
+// 1ブロック分が入りきらない時はブロックごと捨てて, 次のRECORD_BLOCKのflagsに印を付ける
+class EventRecorder : private juce::Thread
+{
+public:
+    enum RecordType
+    {
+        RECORD_PREPARE = 0, // channel: チャンネル数, flags: delay[0]のlane数, numSamples: maxBlockSize, values: sampleRate, delayTimeMax, roomSizeMax
+        RECORD_BLOCK,       // channel: チャンネル数, numSamples, values: delayTime, roomSize, mix, volume
+        RECORD_TAP_TABLE,   // switchTapTable(), values: delayTime, roomSize
+        RECORD_GATE,        // numSamples: ブロック内の位置, values: open, retrigger
+        RECORD_BYPASS,      // このブロックはpushHistory()だけ
+        RECORD_AUDIO,       // channel, numSamples, 入力 (処理前)
+        RECORD_FADE,        // channel: delayの番号, values: ブロック終了時のfadeState
+        RECORD_WIDTH        // values: width (変わった時だけ)
+    };
+    enum BlockFlags
+    {
+        BLOCK_QUALITY_OFFLINE = 1,
+        BLOCK_DROPPED_BEFORE = 2, // 直前のブロックを捨てた
+        BLOCK_LINEAR = 4
+    };
+
+    struct Record
+    {
+        juce::uint8 type;
+        juce::uint8 channel;
+        juce::uint16 flags;
+        juce::int32 numSamples;
+        juce::int64 ticks;
+        float values[4];
+    };
+    static_assert (sizeof (Record) == 32, "Record layout is part of the file format");
+
+    EventRecorder();
+    ~EventRecorder() override;
+
+    //------------------------------------------------------------------------
+    // message thread / prepareToPlay
+    // リングはstart()で確保する (記録しないインスタンスはメモリを使わない)
+    bool start (const juce::File& file, bool shouldRecordAudio);
+    void stop();
+    bool isRecording() const { return recording.load(); }
+    int getNumDroppedBlocks() const { return numDroppedBlocks.load(); }
+
+    // 同じパスを指定した全インスタンス (別プロセスも) が上書きし合わないように
+    // "name-<プロセスごとの値>-<プロセス内の連番>.ext" にする
+    static juce::File getUniqueFile (const juce::File& file);
+
+    //------------------------------------------------------------------------
+    // audio thread (prepareToPlayも含め1つのthreadからだけ呼ぶ)
+    void recordPrepare (double sampleRate, int maxBlockSize, int numChannels, int numLanes, float delayTimeMax, float roomSizeMax);
+    void recordBlock (const juce::AudioBuffer<float>& buffer, int numChannels, float delayTime, float roomSize, float mix, float volume, int flags);
+    void recordTapTable (float delayTime, float roomSize);
+    void recordGate (int samplePosition, bool open, bool retrigger);
+    void recordBypass();
+    void recordFadeStates (const std::vector<MultiTapDelay>& delay);
+    void recordWidth (float width);
+
+    //------------------------------------------------------------------------
+    struct ReplayResult
+    {
+        bool opened = false;            // ファイルが読めて形式が合っていた
+        int numBlocks = 0;
+        int numDroppedGaps = 0;         // 記録中にブロックを捨てた箇所 (BLOCK_DROPPED_BEFORE) の数
+        int numFadeMismatches = 0;      // 記録したfadeStateと再処理の結果が違ったブロック数
+        juce::int64 firstMismatchTicks = 0;
+
+        // ファイルが読めて, 捨てたブロックも食い違いもない
+        bool isExact() const { return opened && numDroppedGaps == 0 && numFadeMismatches == 0; }
+    };
+
+    // 記録したブロックをMultiTapDelayで同じ順番に処理し直す, onBlockには処理後のバッファが渡る
+    // 入力を記録していない時は無音で処理する
+    static ReplayResult replay (const juce::File& file, std::function<void (const juce::AudioBuffer<float>&)> onBlock = nullptr);
+
+private:
+    void run() override;
+    bool write (const void* data, int numBytes);
+    void write (RecordType type, int channel, int flags, int numSamples, float v0 = 0, float v1 = 0, float v2 = 0, float v3 = 0);
+    void drain();
+
+    static constexpr int ringSize = 1 << 22;
+    static constexpr int maxChannels = 16;
+    juce::AbstractFifo fifo { ringSize };
+    juce::HeapBlock<char> ring;
+
+    std::unique_ptr<juce::FileOutputStream> stream;
+    std::atomic<bool> recording { false };
+    std::atomic<int> numDroppedBlocks { 0 };
+    bool recordAudio = false;
+
+    // audio thread only
+    bool blockDropped = false;
+    bool droppedBefore = false;
+    std::array<int, maxChannels> lastFadeState;
+    float lastWidth = -1.0f;
+
+    JUCE_DECLARE_NON_COPYABLE (EventRecorder)
+};
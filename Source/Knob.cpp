@@ -1,13 +0,0 @@
-/*
-  ==============================================================================
-
-    Knob.cpp
-    Created: 12 Mar 2021 8:14:50am
-    Author:  migizo
-
-  ==============================================================================
-*/
-
-#include "Knob.h"
-const char* Knob::knob_png = (const char*) resource_knob_png;
-const int Knob::knob_pngSize = 613;
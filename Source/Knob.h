@@ -11,7 +11,8 @@
 #pragma once
 #include <JuceHeader.h>
 
-#include "KnobResource.h"
+#include "RepaintCounter.h"
+#include "EditorAssets.h"
 
 class Knob : public juce::LookAndFeel_V4
 {
@@ -19,32 +20,29 @@ public:
     Knob()
     {
         setColour (juce::Slider::textBoxOutlineColourId, juce::Colours::transparentBlack);
-        cachedImage_knob = juce::ImageCache::getFromMemory (knob_png, knob_pngSize);
-
     }
 
 
     void drawRotarySlider (juce::Graphics& g, int x, int y, int width, int height, float sliderPos,
                            const float rotaryStartAngle, const float rotaryEndAngle, juce::Slider&) override
     {
-        auto radius = (float) juce::jmin (width / 2, height / 2) - 4.0f;
-        auto centreX = (float) x + (float) width  * 0.5f;
-        auto centreY = (float) y + (float) height * 0.5f;
-        auto rx = centreX - radius;
-        auto ry = centreY - radius;
-        auto rw = radius * 2.0f;
         auto angle = rotaryStartAngle + sliderPos * (rotaryEndAngle - rotaryStartAngle);
 
-        g.setColour (juce::Colours::black);
-        // g.drawImage (cachedImage_knob, x, y, width, height, 0, 0, cachedImage_knob.getWidth(), cachedImage_knob.getHeight());
-        auto imgW = cachedImage_knob.getWidth();
-        auto imgH = cachedImage_knob.getHeight();
+        auto* assets = EditorAssets::getInstance();
+        auto scale = g.getInternalContext().getPhysicalPixelScaleFactor();
+        auto& strip = assets->getKnobFilmstrip (scale);
+        if (! strip.isValid())
+            return; // デコード中, 背景だけ見える
+        auto imgW = assets->getKnobWidth();
+        auto imgH = assets->getKnobHeight();
+        auto frameW = strip.getWidth();
+        auto frameH = strip.getHeight() / EditorAssets::numKnobFrames;
         auto pivotX = width/2-imgW/2;
-        g.drawImageTransformed(cachedImage_knob, juce::AffineTransform::translation(pivotX, 0).rotated (angle, pivotX + imgW/2, imgH/2));
+
+        // 回転済みのフレームをコピーするだけ (フレームはスケールの段階で作ってあるので少しだけ縮める)
+        RepaintCounter::addPaint (g);
+        g.setColour (juce::Colours::black);
+        g.drawImage (strip, pivotX, 0, imgW, imgH,
+                     0, assets->getKnobFrameIndex (angle) * frameH, frameW, frameH);
     }
-    
-    juce::Image cachedImage_knob;
-    
-    static const char* knob_png;
-    static const int knob_pngSize;
 };
\ No newline at end of file
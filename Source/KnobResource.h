@@ -1,23 +0,0 @@
-/*
-  ==============================================================================
-
-    KnobResource.h
-    Created: 12 Mar 2021 8:12:29am
-    Author:  migizo
-
-  ==============================================================================
-*/
-
-#pragma once
-
-static const unsigned char resource_knob_png[] = { 137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,36,0,0,0,36,8,6,0,0,0,225,0,152,152,0,0,0,1,115,82,71,66,0,174,206,28,233,0,0,0,56,101,88,
-73,102,77,77,0,42,0,0,0,8,0,1,135,105,0,4,0,0,0,1,0,0,0,26,0,0,0,0,0,2,160,2,0,4,0,0,0,1,0,0,0,36,160,3,0,4,0,0,0,1,0,0,0,36,0,0,0,0,9,198,193,198,0,0,1,219,73,68,65,84,88,9,205,152,253,109,131,48,16,
-197,3,234,255,161,27,100,131,178,65,189,65,188,65,217,32,221,160,35,148,13,210,13,74,39,128,78,208,100,131,108,80,54,160,239,33,27,25,226,34,243,105,78,122,226,140,125,247,126,178,33,77,26,236,6,70,85,
-85,17,74,142,144,132,152,83,49,196,184,64,165,82,134,235,87,16,4,28,207,31,0,145,80,14,13,141,28,5,114,54,34,52,19,16,155,78,141,28,13,196,36,48,52,56,67,46,113,195,34,202,37,222,7,67,161,107,4,229,46,
-221,177,134,207,74,29,204,29,107,114,172,139,116,93,239,149,11,161,31,200,53,132,110,136,2,30,175,107,208,227,14,42,212,205,140,235,39,242,216,24,47,149,210,131,94,173,104,1,129,248,140,89,209,90,177,
-236,128,59,154,154,22,13,16,38,8,146,152,147,43,229,39,229,93,219,53,64,24,189,173,4,96,179,105,188,107,32,16,74,172,18,182,149,43,221,227,209,145,97,167,119,232,117,37,227,62,155,132,147,33,200,34,92,
-159,57,240,28,71,178,112,135,234,173,242,12,163,237,229,38,129,120,100,91,137,250,200,246,91,161,1,199,158,71,22,111,8,40,214,175,253,102,152,8,116,157,72,243,98,212,159,140,124,76,122,125,64,85,57,166,
-210,168,73,240,249,33,212,248,96,220,31,147,150,115,0,209,248,48,198,221,82,83,242,200,50,203,132,175,91,89,160,254,116,252,250,34,232,248,62,134,234,119,211,119,103,194,199,176,254,13,167,95,251,212,
-7,65,199,243,163,53,198,209,21,144,175,40,90,48,28,128,132,95,146,124,133,184,3,82,80,169,7,162,254,199,5,64,107,30,93,97,221,25,243,38,128,248,67,241,178,194,78,209,35,50,189,255,205,21,212,146,59,197,
-222,110,48,38,37,138,150,120,166,250,159,25,19,192,150,3,138,111,223,28,187,197,30,194,230,49,234,30,154,73,40,131,134,6,107,164,171,105,224,186,80,175,67,115,158,61,13,40,230,212,19,196,224,119,171,82,
-41,195,53,27,250,47,189,63,156,95,130,217,104,24,181,215,0,0,0,0,73,69,78,68,174,66,96,130,0,0};
\ No newline at end of file
@@ -8,12 +8,47 @@
 #ifndef multiTapDelay_h
 #define multiTapDelay_h
 
-#include <deque>
+#include <vector>
+#include <array>
 #include <cmath>
+#include <algorithm>
+#include <limits>
+#include "Trace.h"
 
 class MultiTapDelay {
 public:
 
+    static constexpr int numTaps = 25;
+
+    // calculate()で作るタップ位置(サンプル)と音量, fractionsはタップ位置の小数部分 (QUALITY_OFFLINEで使う)
+    // laneOffsetsはL/RペアのRだけ遠くするサンプル数 (widthで決まる, compileTapTable()では0, 鳴らすインスタンスが入れる)
+    struct TapTable
+    {
+        std::array<int, numTaps> samples {};
+        std::array<float, numTaps> fractions {};
+        std::array<float, numTaps> volumes {};
+        std::array<int, numTaps> laneOffsets {};
+        float sampleRate = 44100.0f;
+        float delayTime = 15.0f;
+        float roomSize = 30.0f;
+    };
+
+    // QUALITY_REALTIME : タップ位置は整数, historyはfloat, 1E-4未満の入力は0にする
+    // QUALITY_OFFLINE  : タップ位置は線形補間, historyはdouble, 入力の閾値なし
+    // どちらもhistoryが全部0の間はタップを読まない (結果は変わらない)
+    //
+    // 2つの差(出力)の上限, タップjの音量g_j, 位置d_j (L/RペアのRはlaneOffsetsを足す), 小数部分f_j, 入力x, A = 入力の最大振幅:
+    //   |差[n]| <= mix * volume * Σj g_j * (f_j * |x[n-d_j-1] - x[n-d_j]| + t(x[n-d_j])) + ε
+    //   f_j * |x[n-d_j-1] - x[n-d_j]| : 線形補間と整数タップの差 (小数部分 × タップ位置での傾き)
+    //   t(x) : REALTIMEの入力閾値で0にされた分 (|x| < 1E-4ならそのまま|x|, それ以外は0)
+    //   ε = 2^-24 * (2 * numTaps + 8) * Σj g_j * A : タップごとのfloatへの丸めと出力のmix
+    //   wetが±1でクリップされても差は広がらない, クリップしなければ差は符号付きの和 (絶対値を取る前) にεの範囲で一致する
+    enum Quality
+    {
+        QUALITY_REALTIME = 0,
+        QUALITY_OFFLINE
+    };
+
     // TODO: LPF? preDelayTimeに名前変える?
     // fadeCounter, fadeState : timeを変えた時のプチプチ音対策, 音をフェードで消す
     // fadeCountWait : 連続してtimeを変えた時にフェードインするのタイミングを遅らせる
@@ -24,67 +59,210 @@ public:
 //        calculate();
 //    }
     //------------------------------------------------------------------------
-    // tapSamples配列を用意、一番長いtapSamplesに合わせてbufferリサイズ、0でクリア
+    // tapSamples配列を用意、一番長いtapSamplesに合わせてhistoryを確保、0でクリア
     MultiTapDelay()
     {
         tapSamples =
         {2,   3,   5,   7,  11,  13,  17,  19,  23,  29,
         31,  37,  41,  43,  47,  53,  59,  61,  67,  71,
         73,  79,  83,  89,  97};
+        tapTotalNum = tapSamples.size();
+        reserveMaxHistory();
         calculate();
     }
     //------------------------------------------------------------------------
-    template<typename SampleType>
-    void process(juce::AudioBuffer<SampleType>& audioBuffer, int channel, int numSamples)
+    // prepareToPlayから呼ぶ
+    // タップ数とキャッシュサイズからタイル長を決め, 作業バッファとhistoryを確保しておく
+    void prepare(float sampleRate, int maximumBlockSize)
     {
-        auto* inBuf = audioBuffer.getReadPointer (channel);
-        auto* outBuf = audioBuffer.getWritePointer (channel);
-        for (int i = 0; i < numSamples; i++) {
-            
-            float fadeVolume = 1.0f;
-            if (fadeState != FADE_NONE)
-            {
-                fadeVolume = fminf(1.0f, fmaxf(0.0f, (float)fadeCounter / (float)fadeCountMax));
-                if (fadeState == FADE_OUT)
-                {
-                    fadeCounter--;
-                    if (fadeCounter <= 0 - fadeCountWait)
-                    {
-                        fadeState = FADE_IN;
-                        fadeCountWait = 0;
-                        calculate();
-                    }
-                }
-                else if (fadeState == FADE_IN)
-                {
-                    fadeCounter++;
-                    if (fadeCounter >= fadeCountMax + fadeCountWait) fadeState = FADE_NONE;
-                }
+        setSampleRate(sampleRate);
+        tileSize = calculateTileSize(maximumBlockSize);
+        fadeGains.assign(tileSize, 0.0f);
+        accumulator.assign(tileSize * numLanes, 0.0);
+        crossfadeAccumulator.assign(tileSize * numLanes, 0.0);
+        reserveMaxHistory();
+    }
+    //------------------------------------------------------------------------
+    // 2にするとL/Rのチャンネルペアを1つのインスタンスでprocessPair()する
+    // historyはL/R交互に並べ, 1タップ = 同じループでLとR (widthのずれの分だけ後ろ) を読むだけ (monoとほぼ同じコスト)
+    // historyは作り直して0になる, prepare()の前にaudio thread以外から呼ぶ
+    void setNumLanes(int numLanes)
+    {
+        numLanes = std::max(1, std::min(2, numLanes));
+        if (this->numLanes == numLanes) return;
+        this->numLanes = numLanes;
+        std::vector<float>().swap(historyFloat);
+        std::vector<double>().swap(history);
+        historySize = 0;
+        writePos = 0;
+        silentSamples = 0;
+        accumulator.assign(tileSize * numLanes, 0.0);
+        crossfadeAccumulator.assign(tileSize * numLanes, 0.0);
+        reserveMaxHistory();
+        applyLaneOffsets(tapTable);
+    }
+    int getNumLanes() const { return numLanes; }
+    //------------------------------------------------------------------------
+    // processPair()用, 0~100
+    // 音量: 偶数番目のタップはL寄り, 奇数番目はR寄りにする (タップごとのL+Rは変わらない, width 100で 1.5 : 0.5)
+    // 位置: Rのタップjを次の素数との間へずらす (width 100で間の半分, 整数サンプル), Lのタップの間にRのタップが入る
+    // 位置が変わる時はswitchTapTable()と同じく50msクロスフェードする
+    // 0ならL/Rはmonoのインスタンス2つで処理したのと同じ結果
+    void setWidth(float width)
+    {
+        width = std::max(0.0f, std::min(100.0f, width));
+        if (this->width == width) return;
+        this->width = width;
+        widthAmount = width / 100.0f * maxWidthSpread;
+
+        TapTable table = tapTable;
+        applyLaneOffsets(table);
+        if (table.laneOffsets == tapTable.laneOffsets) return;
+        previousTapTable = tapTable;
+        tapTable = table;
+        tapTableVersion++;
+        crossfadeCountMax = getCrossfadeLength(sampleRate);
+        crossfadeCounter = crossfadeCountMax;
+    }
+    float getWidth() const { return width; }
+    //------------------------------------------------------------------------
+    // setQuality()で使うもう一方の型のhistoryを確保しておく, audio thread以外から呼ぶ
+    void reserveQuality(Quality quality)
+    {
+        if (this->quality == quality) return;
+        if (quality == QUALITY_REALTIME) historyFloat.resize(history.size());
+        else history.resize(historyFloat.size());
+    }
+    //------------------------------------------------------------------------
+    // historyの型を切り替える, historyの中身は引き継ぐ
+    // reserveQuality()の後ならコピーだけ (audio threadから呼べる), 前の型のhistoryは残しておく
+    void setQuality(Quality quality)
+    {
+        if (this->quality == quality) return;
+        if (quality == QUALITY_REALTIME) copyHistory(history, historyFloat);
+        else copyHistory(historyFloat, history);
+        this->quality = quality;
+    }
+    Quality getQuality() const { return quality; }
+    //------------------------------------------------------------------------
+    // 使っていない方の型のhistoryを解放する, audio thread以外から呼ぶ
+    void releaseSpareHistory()
+    {
+        if (quality == QUALITY_REALTIME) std::vector<double>().swap(history);
+        else std::vector<float>().swap(historyFloat);
+    }
+    //------------------------------------------------------------------------
+    // true : 入力の閾値(1E-4)と出力の±1クリップをしない, 出力はgetImpulseResponse()のFIRと同じになる
+    // (フェード/クロスフェード/ゲートが動いていない間, 差はfloatの丸めだけ)
+    void setLinear(bool linear)
+    {
+        this->linear = linear;
+    }
+    bool isLinear() const { return linear; }
+    //------------------------------------------------------------------------
+    // tableで鳴らした時のインパルス応答, 入力x, 出力yで
+    //   y[n] = (1 - mix) * volume * x[n] + Σj mix * volume * g_j * x[n - d_j]
+    //   g_j : タップ音量 (L/Rペアの時はwidthの偏りを掛ける), d_j : タップ位置 (Rはwidthのずれを足す)
+    //   QUALITY_OFFLINEはd_jとd_j+1に (1 - 小数部) : 小数部 で分ける
+    // lane : processPair()の時の 0 = L, 1 = R, widthはこのインスタンスの値 (compileTapTable()のtableでもそのまま使える)
+    std::vector<float> getImpulseResponse(const TapTable& table, int lane = 0) const
+    {
+        ResponseSettings settings = getResponseSettings();
+        settings.tapTable = table;
+        applyLaneOffsets(settings.tapTable);
+        return getImpulseResponse(settings, lane);
+    }
+    //------------------------------------------------------------------------
+    // getImpulseResponse()に要る設定だけのコピー (historyは含まない), audio threadから別のthreadへ渡す用
+    // tapTableはフェードの途中なら切り替わった後のもの
+    struct ResponseSettings
+    {
+        TapTable tapTable;
+        float mix = 1.0f;
+        float volume = 1.0f;
+        float widthAmount = 0.0f;
+        Quality quality = QUALITY_REALTIME;
+        int numLanes = 1;
+    };
+    ResponseSettings getResponseSettings() const
+    {
+        ResponseSettings settings;
+        settings.tapTable = tapTable;
+        if (tapTable.delayTime != delayTime || tapTable.roomSize != roomSize || tapTable.sampleRate != sampleRate) {
+            settings.tapTable = compileTapTable(delayTime, roomSize);
+            applyLaneOffsets(settings.tapTable);
+        }
+        settings.mix = mix;
+        settings.volume = volume;
+        settings.widthAmount = widthAmount;
+        settings.quality = quality;
+        settings.numLanes = numLanes;
+        return settings;
+    }
+    static std::vector<float> getImpulseResponse(const ResponseSettings& settings, int lane)
+    {
+        const TapTable& table = settings.tapTable;
+        std::array<int, numTaps> positions;
+        int length = 1;
+        for (int j = 0; j < numTaps; j++) {
+            positions[j] = table.samples[j] + (lane == 1 ? table.laneOffsets[j] : 0);
+            length = std::max(length, positions[j] + 2);
+        }
+
+        std::vector<double> response(length, 0.0);
+        response[0] = (1.0f - settings.mix) * settings.volume;
+        for (int j = 0; j < numTaps; j++) {
+            const float spread = (j % 2 == 0) ? settings.widthAmount : -settings.widthAmount;
+            const float tapVolume = settings.numLanes == 1 ? table.volumes[j] : table.volumes[j] * (lane == 0 ? 1.0f + spread : 1.0f - spread);
+            const double gain = (double)settings.mix * settings.volume;
+            if (settings.quality == QUALITY_REALTIME) {
+                response[positions[j]] += gain * tapVolume;
             }
-            // 現在の音を取得しpush
-            SampleType tmp = inBuf[i];
-            SampleType inTmp = tmp;
-            if (abs(tmp) < 1E-4) tmp = 0;
-            buffer.push_front(tmp);
-            buffer.resize(tapSampleMaxSize);
-
-            // 配列の、先頭からtapSamples分ずらした位置のを読み込み加算
-            tmp = 0;
-            for (int j = 0; j < tapTotalNum; j++) {
-                tmp += buffer[calculateTapSamples[j]] * tapVolumes[j];
+            else {
+                response[positions[j]] += gain * (tapVolume * (1.0f - table.fractions[j]));
+                response[positions[j] + 1] += gain * (tapVolume * table.fractions[j]);
             }
-            tmp *= fadeVolume;
-            tmp = fminf(1.0, fmaxf(-1.0, tmp));
-
-            // delay音を返す
-            outBuf[i] = ((1.0f - mix) * inTmp + mix * tmp) * volume;
         }
+        return std::vector<float>(response.begin(), response.end());
+    }
+    //------------------------------------------------------------------------
+    // ホストのブロックをtileSizeごとに区切って処理する
+    // 1サンプルずつ処理した場合と同じ結果になる
+    template<typename SampleType>
+    void process(juce::AudioBuffer<SampleType>& audioBuffer, int channel, int numSamples)
+    {
+        process(audioBuffer, channel, 0, numSamples);
+    }
+    //------------------------------------------------------------------------
+    // MIDIイベントなどでブロックを区切って処理する時用
+    template<typename SampleType>
+    void process(juce::AudioBuffer<SampleType>& audioBuffer, int channel, int startSample, int numSamples)
+    {
+        RG_TRACE_SCOPE_CHANNEL("MultiTapDelay::process", channel);
+        if (numLanes != 1) return;
+        const SampleType* inBufs[1] = { audioBuffer.getReadPointer (channel, startSample) };
+        SampleType* outBufs[1] = { audioBuffer.getWritePointer (channel, startSample) };
+        processTiles<1>(inBufs, outBufs, numSamples);
     }
     //------------------------------------------------------------------------
+    // setNumLanes(2)の時にチャンネル0/1をまとめて処理する
+    template<typename SampleType>
+    void processPair(juce::AudioBuffer<SampleType>& audioBuffer, int startSample, int numSamples)
+    {
+        RG_TRACE_SCOPE("MultiTapDelay::processPair");
+        if (numLanes != 2) return;
+        const SampleType* inBufs[2] = { audioBuffer.getReadPointer (0, startSample), audioBuffer.getReadPointer (1, startSample) };
+        SampleType* outBufs[2] = { audioBuffer.getWritePointer (0, startSample), audioBuffer.getWritePointer (1, startSample) };
+        processTiles<2>(inBufs, outBufs, numSamples);
+    }
+    //------------------------------------------------------------------------
+    // サンプルレートと最大値はhistoryの長さを決める, 変わった時だけ確保し直す (audio threadで毎ブロック同じ値を渡すのは構わない)
     void setSampleRate(float sampleRate)
     {
-        if (this->sampleRate != sampleRate) standbyCalculate();
+        if (this->sampleRate == sampleRate) return;
+        standbyCalculate();
         this->sampleRate = sampleRate;
+        reserveMaxHistory();
     }
     //------------------------------------------------------------------------
     void setRoomSize(float roomSize)
@@ -111,14 +289,103 @@ public:
     //------------------------------------------------------------------------
     void setRoomSizeMax(float roomSizeMax)
     {
-        if (this->roomSizeMax != roomSizeMax) standbyCalculate();
+        if (this->roomSizeMax == roomSizeMax) return;
+        standbyCalculate();
         this->roomSizeMax = roomSizeMax;
+        reserveMaxHistory();
     }
     //------------------------------------------------------------------------
     void setDelayTimeMax(float delayTimeMax)
     {
-        if (this->delayTimeMax != delayTimeMax) standbyCalculate();
+        if (this->delayTimeMax == delayTimeMax) return;
+        standbyCalculate();
         this->delayTimeMax = delayTimeMax;
+        reserveMaxHistory();
+    }
+    //------------------------------------------------------------------------
+    // bypass中用: タップは読まずにhistoryへ入力を書き込むだけ
+    // 音は出さないので, 保留中のフェード/クロスフェード/ゲートのランプはここで終わらせておく
+    // (bypassを戻した時にすぐ正しい音になる)
+    template<typename SampleType>
+    void pushHistory(const SampleType* inBuf, int numSamples)
+    {
+        const SampleType* inBufs[1] = { inBuf };
+        pushHistory<1>(inBufs, numSamples);
+    }
+    template<typename SampleType>
+    void pushHistory(const SampleType* left, const SampleType* right, int numSamples)
+    {
+        const SampleType* inBufs[2] = { left, right };
+        if (numLanes == 2) pushHistory<2>(inBufs, numSamples);
+    }
+    //------------------------------------------------------------------------
+    // wet信号のゲート, 次に処理するサンプルから有効 (開閉は短いランプ)
+    // retrigger : これより前の入力をタップから読まない, reverseの立ち上がりを頭からやり直す
+    void setGate(bool open, bool retrigger)
+    {
+        gateTarget = open ? 1.0f : 0.0f;
+        gateRampRemaining = gateTarget == gateGain ? 0 : std::max(1, (int)(2.0f / 1000.0f * sampleRate));
+        gateRampStep = (gateTarget - gateGain) / (float)std::max(1, gateRampRemaining);
+        if (retrigger) samplesSinceTrigger = 0;
+    }
+    //------------------------------------------------------------------------
+    // visualiser用, 有効な時だけwet信号のpeakと二乗和を溜める
+    void setMeteringEnabled(bool meteringEnabled)
+    {
+        this->meteringEnabled = meteringEnabled;
+    }
+    //------------------------------------------------------------------------
+    // 溜めたwet信号のpeakと二乗和を加算して, 溜めたものはクリア
+    void takeWetLevel(float& peak, double& sumSquares, int& numSamples)
+    {
+        peak = std::max(peak, wetPeak);
+        sumSquares += wetSquares;
+        numSamples += wetNumSamples;
+        wetPeak = 0.0f;
+        wetSquares = 0.0;
+        wetNumSamples = 0;
+    }
+    //------------------------------------------------------------------------
+    const TapTable& getTapTable() const { return tapTable; }
+    int getTapTableVersion() const { return tapTableVersion; }
+    int getFadeState() const { return fadeState; }
+    float getDelayTime() const { return delayTime; }
+    float getRoomSize() const { return roomSize; }
+    float getMix() const { return mix * 100.0f; } // setMix()と同じ0~100
+    float getVolume() const { return volume; }
+    //------------------------------------------------------------------------
+    // calculate()と同じtap tableをaudio thread以外で前もって作る (presetなど), laneOffsetsはswitchTapTable()で入る
+    TapTable compileTapTable(float delayTime, float roomSize) const
+    {
+        TapTable table;
+        for (int i = 0; i < numTaps; i++) {
+            table.volumes[i] = 0.02f * (i+1);
+            const float exactSampleSize = getExactSampleSize(delayTime, roomSize, tapSamples[i], i);
+            table.samples[i] = (int)exactSampleSize;
+            table.fractions[i] = exactSampleSize - (float)table.samples[i];
+        }
+        table.sampleRate = sampleRate;
+        table.delayTime = delayTime;
+        table.roomSize = roomSize;
+        return table;
+    }
+    //------------------------------------------------------------------------
+    // 作ってあるtap tableに切り替える, calculate()もフェードアウトもせず新旧のtapをクロスフェード
+    // audio threadから呼ぶ
+    void switchTapTable(const TapTable& table)
+    {
+        delayTime = table.delayTime;
+        roomSize = table.roomSize;
+        if (table.sampleRate != sampleRate) {
+            standbyCalculate();
+            return;
+        }
+        previousTapTable = tapTable;
+        tapTable = table;
+        applyLaneOffsets(tapTable);
+        tapTableVersion++;
+        crossfadeCountMax = getCrossfadeLength(sampleRate);
+        crossfadeCounter = crossfadeCountMax;
     }
     //------------------------------------------------------------------------
     void standbyCalculate()
@@ -132,25 +399,390 @@ public:
         fadeState = FADE_OUT;
         fadeCountWait = 0;
     }
+    //------------------------------------------------------------------------
+    // 1サンプル(1タップ)あたりの計算, BatchEngineも同じものを使う (結果がビット単位で揃う)
+    //------------------------------------------------------------------------
+    // historyに書く時の入力の閾値, これ未満は0にする
+    static double getInputThreshold(Quality quality, bool linear)
+    {
+        return quality == QUALITY_REALTIME && !linear ? 1E-4 : 0.0;
+    }
+    // QUALITY_OFFLINEのタップ: samples[j]に (1 - fraction), 1サンプル古いsamples[j] + 1に fraction
+    static void splitTapVolume(float tapVolume, float fraction, float& nearVolume, float& farVolume)
+    {
+        nearVolume = tapVolume * (1.0f - fraction);
+        farVolume = tapVolume * fraction;
+    }
+    // タップ1つ分, runサンプル連続したhistoryを加算する (1回ごとにSampleTypeに丸める)
+    template<int Lanes, typename SampleType, typename HistoryType>
+    static void accumulateRun(const HistoryType* src, const float* tapVolumes, double* out, int run)
+    {
+        for (int k = 0; k < run * Lanes; k += Lanes) {
+            for (int lane = 0; lane < Lanes; lane++)
+                out[k + lane] = (SampleType)(out[k + lane] + src[k + lane] * (double)tapVolumes[lane]);
+        }
+    }
+    // L/Rペア用: Lはleft, Rはright (L/R交互のhistoryの別の位置) から読む, ずれが0ならaccumulateRun<2>と同じ
+    template<typename SampleType, typename HistoryType>
+    static void accumulatePairRun(const HistoryType* left, const HistoryType* right, const float* tapVolumes, double* out, int run)
+    {
+        for (int k = 0; k < run * 2; k += 2) {
+            out[k] = (SampleType)(out[k] + left[k] * (double)tapVolumes[0]);
+            out[k + 1] = (SampleType)(out[k + 1] + right[k + 1] * (double)tapVolumes[1]);
+        }
+    }
+    // tap table切り替えのクロスフェード長, counterはcountMaxから1まで減っていく
+    static int getCrossfadeLength(float sampleRate)
+    {
+        return std::max(1, (int)(50.0f / 1000.0f * sampleRate));
+    }
+    template<typename SampleType>
+    static double crossfade(double current, double previous, int counter, int countMax)
+    {
+        const float previousVolume = (float)counter / (float)countMax;
+        return (SampleType)(current * (1.0f - previousVolume) + previous * previousVolume);
+    }
+    // wet信号の±1クリップ (linearの時はしない) とdryとのmix
+    template<typename SampleType>
+    static SampleType clipWet(SampleType wet, bool linear)
+    {
+        return linear ? wet : (SampleType)fminf(1.0, fmaxf(-1.0, wet));
+    }
+    template<typename SampleType>
+    static SampleType mixOutput(SampleType dry, SampleType wet, float mix, float volume)
+    {
+        return ((1.0f - mix) * dry + mix * wet) * volume;
+    }
 private:
 
+    //------------------------------------------------------------------------
+    // Lanes : 1 = mono, 2 = L/Rペア (history, accumulatorはL/R交互)
+    template<int Lanes, typename SampleType>
+    void processTiles(const SampleType* const* inBufs, SampleType* const* outBufs, int numSamples)
+    {
+        for (int tileStart = 0; tileStart < numSamples; tileStart += tileSize) {
+            const SampleType* in[Lanes];
+            SampleType* out[Lanes];
+            for (int lane = 0; lane < Lanes; lane++) {
+                in[lane] = inBufs[lane] + tileStart;
+                out[lane] = outBufs[lane] + tileStart;
+            }
+            processTile<Lanes>(in, out, std::min(tileSize, numSamples - tileStart));
+        }
+    }
+    //------------------------------------------------------------------------
+    template<int Lanes, typename SampleType>
+    void pushHistory(const SampleType* const* inBufs, int numSamples)
+    {
+        if (fadeState == FADE_OUT) calculate();
+        fadeState = FADE_NONE;
+        crossfadeCounter = 0;
+        gateGain = gateTarget;
+        gateRampRemaining = 0;
+
+        for (int start = 0; start < numSamples; start += tileSize) {
+            const int n = std::min(tileSize, numSamples - start);
+            const SampleType* in[Lanes];
+            for (int lane = 0; lane < Lanes; lane++) in[lane] = inBufs[lane] + start;
+            writeHistory<Lanes>(in, n);
+            advanceHistory(n);
+        }
+    }
+    //------------------------------------------------------------------------
+    // 先にフェード量だけ計算し, calculate()が走るサンプルでspanを区切る
+    // (calculate()後のタップ位置はそのサンプルから有効)
+    template<int Lanes, typename SampleType>
+    void processTile(const SampleType* const* inBufs, SampleType* const* outBufs, int numSamples)
+    {
+        int done = 0;
+        int gained = 0;
+        while (done < numSamples) {
+            bool needsCalculate = false;
+            {
+                RG_TRACE_SCOPE("fade");
+                while (gained < numSamples && !needsCalculate) {
+                    fadeGains[gained++] = nextFadeVolume(needsCalculate);
+                }
+            }
+            int spanEnd = needsCalculate ? gained - 1 : gained;
+            const SampleType* in[Lanes];
+            SampleType* out[Lanes];
+            for (int lane = 0; lane < Lanes; lane++) {
+                in[lane] = inBufs[lane] + done;
+                out[lane] = outBufs[lane] + done;
+            }
+            processSpan<Lanes>(in, out, fadeGains.data() + done, spanEnd - done);
+            if (needsCalculate) calculate();
+            done = spanEnd;
+        }
+    }
+    //------------------------------------------------------------------------
+    template<int Lanes, typename SampleType>
+    void processSpan(const SampleType* const* inBufs, SampleType* const* outBufs, float* fadeVolumes, int numSamples)
+    {
+        if (numSamples <= 0) return;
+        if (gateGain != 1.0f || gateRampRemaining > 0) applyGate(fadeVolumes, numSamples);
+
+        writeHistory<Lanes>(inBufs, numSamples);
+
+        accumulateTaps<Lanes, SampleType>(tapTable, accumulator.data(), numSamples);
+
+        // tap table切り替え直後は旧tableの音からクロスフェード
+        if (crossfadeCounter > 0) {
+            RG_TRACE_SCOPE("crossfade");
+            accumulateTaps<Lanes, SampleType>(previousTapTable, crossfadeAccumulator.data(), numSamples);
+            for (int i = 0; i < numSamples && crossfadeCounter > 0; i++, crossfadeCounter--) {
+                for (int lane = 0; lane < Lanes; lane++) {
+                    const int k = i * Lanes + lane;
+                    accumulator[k] = crossfade<SampleType>(accumulator[k], crossfadeAccumulator[k], crossfadeCounter, crossfadeCountMax);
+                }
+            }
+        }
+
+        {
+            RG_TRACE_SCOPE("clip+mix");
+            for (int lane = 0; lane < Lanes; lane++) {
+                const SampleType* inBuf = inBufs[lane];
+                SampleType* outBuf = outBufs[lane];
+                for (int i = 0; i < numSamples; i++) {
+                    SampleType tmp = (SampleType)accumulator[i * Lanes + lane];
+                    tmp *= fadeVolumes[i];
+                    tmp = clipWet(tmp, linear);
+                    accumulator[i * Lanes + lane] = tmp;
+
+                    // delay音を返す
+                    outBuf[i] = mixOutput(inBuf[i], tmp, mix, volume);
+                }
+            }
+        }
+
+        if (meteringEnabled) {
+            RG_TRACE_SCOPE("metering");
+            for (int i = 0; i < numSamples * Lanes; i++) {
+                wetPeak = std::max(wetPeak, (float)std::abs(accumulator[i]));
+                wetSquares += accumulator[i] * accumulator[i];
+            }
+            wetNumSamples += numSamples * Lanes;
+        }
+
+        advanceHistory(numSamples);
+    }
+    //------------------------------------------------------------------------
+    // 現在の音をhistoryに書き込む, writePosは進めない
+    template<int Lanes, typename SampleType>
+    void writeHistory(const SampleType* const* inBufs, int numSamples)
+    {
+        RG_TRACE_SCOPE("writeHistory");
+        if (quality == QUALITY_REALTIME) writeHistory<Lanes>(historyFloat, inBufs, numSamples, getInputThreshold(quality, linear));
+        else writeHistory<Lanes>(history, inBufs, numSamples, getInputThreshold(quality, linear));
+    }
+    template<int Lanes, typename HistoryType, typename SampleType>
+    void writeHistory(std::vector<HistoryType>& buffer, const SampleType* const* inBufs, int numSamples, double threshold)
+    {
+        int lastSound = -1;
+        for (int lane = 0; lane < Lanes; lane++) {
+            const SampleType* inBuf = inBufs[lane];
+            for (int i = 0, pos = writePos; i < numSamples; i++) {
+                SampleType tmp = inBuf[i];
+                if (std::abs(tmp) < threshold) tmp = 0;
+                if (tmp != 0) lastSound = std::max(lastSound, i);
+                buffer[pos * Lanes + lane] = tmp;
+                if (++pos == historySize) pos = 0;
+            }
+        }
+        // 最後に音があってから何サンプル0が続いているか
+        silentSamples = lastSound < 0 ? std::min(silentSamples + numSamples, untriggered) : numSamples - 1 - lastSound;
+    }
+    //------------------------------------------------------------------------
+    void advanceHistory(int numSamples)
+    {
+        writePos += numSamples;
+        if (writePos >= historySize) writePos -= historySize;
+        samplesSinceTrigger = std::min(samplesSinceTrigger + numSamples, untriggered);
+    }
+    //------------------------------------------------------------------------
+    // ゲート量をフェード量に掛ける, ランプ中以外はspan全体で一定
+    void applyGate(float* fadeVolumes, int numSamples)
+    {
+        int i = 0;
+        for (; i < numSamples && gateRampRemaining > 0; i++, gateRampRemaining--) {
+            gateGain += gateRampStep;
+            fadeVolumes[i] *= gateGain;
+        }
+        if (gateRampRemaining == 0) gateGain = gateTarget;
+        for (; i < numSamples; i++) fadeVolumes[i] *= gateGain;
+    }
+    //------------------------------------------------------------------------
+    // タップごとにspan全体を加算 (加算順は1サンプル処理と同じ)
+    template<int Lanes, typename SampleType>
+    void accumulateTaps(const TapTable& table, double* dst, int numSamples) const
+    {
+        RG_TRACE_SCOPE("accumulateTaps");
+        std::fill(dst, dst + numSamples * Lanes, 0.0);
+        if (silentSamples >= tapSampleMaxSize + numSamples + 1) return; // 読む範囲のhistoryが全部0
+
+        for (int j = 0; j < tapTotalNum; j++) {
+            // L/Rペアの時は偶数番目のタップをL寄り, 奇数番目をR寄りに
+            float tapVolumes[Lanes];
+            const float spread = (j % 2 == 0) ? widthAmount : -widthAmount;
+            for (int lane = 0; lane < Lanes; lane++)
+                tapVolumes[lane] = Lanes == 1 ? table.volumes[j] : table.volumes[j] * (lane == 0 ? 1.0f + spread : 1.0f - spread);
+
+            const int laneOffset = table.laneOffsets[j];
+            if (quality == QUALITY_REALTIME) {
+                accumulateTap<Lanes, SampleType>(historyFloat, table.samples[j], laneOffset, tapVolumes, dst, numSamples);
+            }
+            else {
+                // 1サンプル古い方と線形補間
+                const float fraction = table.fractions[j];
+                float nearVolumes[Lanes], farVolumes[Lanes];
+                for (int lane = 0; lane < Lanes; lane++)
+                    splitTapVolume(tapVolumes[lane], fraction, nearVolumes[lane], farVolumes[lane]);
+                accumulateTap<Lanes, SampleType>(history, table.samples[j], laneOffset, nearVolumes, dst, numSamples);
+                if (fraction > 0.0f)
+                    accumulateTap<Lanes, SampleType>(history, table.samples[j] + 1, laneOffset, farVolumes, dst, numSamples);
+            }
+        }
+    }
+    template<int Lanes, typename SampleType, typename HistoryType>
+    void accumulateTap(const std::vector<HistoryType>& buffer, int tapSample, int laneOffset, const float* tapVolumes, double* dst, int numSamples) const
+    {
+        // retrigger前の入力は読まない
+        const int first = std::min(numSamples, std::max(0, tapSample - samplesSinceTrigger));
+        int readPos = writePos + first - tapSample;
+        if (readPos < 0) readPos += historySize;
+        if (Lanes == 1) {
+            for (int i = first; i < numSamples;) {
+                const int run = std::min(numSamples - i, historySize - readPos);
+                accumulateRun<Lanes, SampleType>(buffer.data() + readPos * Lanes, tapVolumes, dst + i * Lanes, run);
+                i += run;
+                readPos = 0;
+            }
+            return;
+        }
+
+        // L/Rペア: RはlaneOffsetだけ古い位置を同じループで読む, Rの方が遠いのでretrigger直後はLだけ先に読み始める
+        const int firstRight = std::min(numSamples, std::max(0, tapSample + laneOffset - samplesSinceTrigger));
+        const float leftOnly[2] = { tapVolumes[0], 0.0f };
+        int rightPos = readPos - laneOffset;
+        if (rightPos < 0) rightPos += historySize;
+        for (int i = first; i < numSamples;) {
+            int run = std::min(numSamples - i, std::min(historySize - readPos, historySize - rightPos));
+            if (i < firstRight) run = std::min(run, firstRight - i);
+            accumulatePairRun<SampleType>(buffer.data() + readPos * 2, buffer.data() + rightPos * 2,
+                                          i < firstRight ? leftOnly : tapVolumes, dst + i * 2, run);
+            i += run;
+            if ((readPos += run) == historySize) readPos = 0;
+            if ((rightPos += run) == historySize) rightPos = 0;
+        }
+    }
+    //------------------------------------------------------------------------
+    // L/RペアのRのタップjを, 次の素数との間の width / 100 * 半分だけ遠くする (整数サンプル)
+    // 一番遠いタップ (97msの次は101ms) でも2msなので, historyの範囲 (tapSample 100で見積もり) に収まる
+    void applyLaneOffsets(TapTable& table) const
+    {
+        for (int j = 0; j < numTaps; j++) {
+            const int gap = (j + 1 < numTaps ? tapSamples[j + 1] : lastTapNextPrime) - tapSamples[j];
+            table.laneOffsets[j] = numLanes == 2 ? (int)std::lround(width / 100.0f * gap * 0.5f / 1000.0f * sampleRate) : 0;
+        }
+    }
+    //------------------------------------------------------------------------
+    // 1サンプル分フェードを進めて, そのサンプルのフェード量を返す
+    float nextFadeVolume(bool& needsCalculate)
+    {
+        float fadeVolume = 1.0f;
+        if (fadeState != FADE_NONE)
+        {
+            fadeVolume = fminf(1.0f, fmaxf(0.0f, (float)fadeCounter / (float)fadeCountMax));
+            if (fadeState == FADE_OUT)
+            {
+                fadeCounter--;
+                if (fadeCounter <= 0 - fadeCountWait)
+                {
+                    fadeState = FADE_IN;
+                    fadeCountWait = 0;
+                    needsCalculate = true;
+                }
+            }
+            else if (fadeState == FADE_IN)
+            {
+                fadeCounter++;
+                if (fadeCounter >= fadeCountMax + fadeCountWait) fadeState = FADE_NONE;
+            }
+        }
+        return fadeVolume;
+    }
+    //------------------------------------------------------------------------
     void calculate()
     {
+        RG_TRACE_SCOPE("calculate");
         tapTotalNum = tapSamples.size();
-        tapVolumes.resize(tapTotalNum);
-        calculateTapSamples.resize(tapTotalNum);
-        for (int i = 0; i < tapTotalNum; i++) {
-            tapVolumes[i] = 0.02f * (i+1);
-            calculateTapSamples[i] = (int)getSampleSize(delayTime, roomSize, tapSamples[i], i);
-        }
+        tapTable = compileTapTable(delayTime, roomSize);
+        applyLaneOffsets(tapTable);
+        tapTableVersion++;
+        crossfadeCounter = 0;
+        int prevMaxSize = tapSampleMaxSize;
         tapSampleMaxSize = 1 + getSampleSize(delayTimeMax, roomSizeMax, 100, tapTotalNum - 1);
-        if (buffer.size() > tapSampleMaxSize) {}
-        else {
-            std::vector<float> zeroBuf(tapSampleMaxSize - buffer.size());
-            buffer.insert(buffer.end(), zeroBuf.begin(), zeroBuf.end());
+
+        // historyはreserveMaxHistory()で確保済み (audio threadでは確保しない), 新しく読む範囲は0でクリア
+        for (int d = prevMaxSize; d < tapSampleMaxSize; d++) {
+            int pos = writePos - 1 - d;
+            while (pos < 0) pos += historySize;
+            for (int lane = 0; lane < numLanes; lane++) {
+                if (quality == QUALITY_REALTIME) historyFloat[pos * numLanes + lane] = 0;
+                else history[pos * numLanes + lane] = 0;
+            }
+        }
+    }
+    //------------------------------------------------------------------------
+    // 最大のdelay time/room size (今のサンプルレート) で読む一番遠いタップまで入るようにhistoryを確保する
+    void reserveMaxHistory()
+    {
+        reserveHistory(1 + getSampleSize(delayTimeMax, roomSizeMax, 100, tapTotalNum - 1));
+    }
+    // historyはリングバッファ, tileSize分の書き込みで読み出し範囲を潰さないサイズにする
+    void reserveHistory(int maxSize)
+    {
+        const int required = maxSize + tileSize;
+        if (historySize >= required) return;
+
+        if (quality == QUALITY_REALTIME) resizeHistory(historyFloat, required);
+        else resizeHistory(history, required);
+        historySize = required;
+        writePos = 0;
+    }
+    template<typename From, typename To>
+    static void copyHistory(const std::vector<From>& from, std::vector<To>& to)
+    {
+        if (to.size() == from.size()) std::copy(from.begin(), from.end(), to.begin());
+        else to.assign(from.begin(), from.end());
+    }
+    template<typename HistoryType>
+    void resizeHistory(std::vector<HistoryType>& buffer, int required)
+    {
+        std::vector<HistoryType> resized(required * numLanes, 0);
+        for (int d = 0; d < std::min(tapSampleMaxSize, historySize); d++) {
+            int pos = writePos - 1 - d;
+            if (pos < 0) pos += historySize;
+            for (int lane = 0; lane < numLanes; lane++)
+                resized[(required - 1 - d) * numLanes + lane] = buffer[pos * numLanes + lane];
         }
+        buffer.swap(resized);
+    }
+    //------------------------------------------------------------------------
+    // 1サンプルあたりの作業量(各タップの読み出し+accumulator+fadeGains)がキャッシュに収まる長さ
+    int calculateTileSize(int maximumBlockSize) const
+    {
+        const int bytesPerSample = (tapTotalNum * sizeof(double) + sizeof(double)) * numLanes + sizeof(float); // doubleのhistoryで見積もる
+        int size = minTileSize;
+        while (size * 2 * bytesPerSample <= cacheSizeBytes) size *= 2;
+        return std::max(1, std::min(size, maximumBlockSize));
     }
-    int getSampleSize(float delayTime, float roomSize, int tapSample, int tapID)
+    int getSampleSize(float delayTime, float roomSize, int tapSample, int tapID) const
+    {
+        return getExactSampleSize(delayTime, roomSize, tapSample, tapID);
+    }
+    float getExactSampleSize(float delayTime, float roomSize, int tapSample, int tapID) const
     {
         return (((delayTime + tapSample + roomSize * (float)tapID)/1000.0f)*sampleRate);
     }
@@ -165,12 +797,46 @@ private:
     int fadeCountMax;
     int fadeCountWait;
     
-    std::deque<double> buffer;
-    std::vector<int> tapSamples;
-    std::vector<float> tapVolumes;
-    std::vector<int> calculateTapSamples;
+    static constexpr int cacheSizeBytes = 256 * 1024;
+    static constexpr int minTileSize = 32;
+    static constexpr float maxWidthSpread = 0.5f; // width 100でL/Rの音量は 1.5 : 0.5
+    static constexpr int lastTapNextPrime = 101;  // tapSamplesの最後 (97) の次の素数
+
+    Quality quality = QUALITY_REALTIME;
+    bool linear = false;
+    int numLanes = 1;
+    float width = 0.0f;
+    float widthAmount = 0.0f;
+    std::vector<float> historyFloat;
+    std::vector<double> history;
+    int historySize = 0;
+    int silentSamples = 0;
+    int writePos = 0;
+    int tileSize = 512;
+    std::vector<float> fadeGains = std::vector<float>(512);
+    std::vector<double> accumulator = std::vector<double>(512);
+    std::vector<double> crossfadeAccumulator = std::vector<double>(512);
+
+    std::array<int, numTaps> tapSamples;
+    TapTable tapTable;
+    TapTable previousTapTable;
+    int tapTableVersion = 0;
+    int crossfadeCounter = 0;
+    int crossfadeCountMax = 1;
     int tapTotalNum;
-    int tapSampleMaxSize;
+
+    float gateGain = 1.0f;
+    float gateTarget = 1.0f;
+    float gateRampStep = 0.0f;
+    int gateRampRemaining = 0;
+    static constexpr int untriggered = std::numeric_limits<int>::max() / 2;
+    int samplesSinceTrigger = untriggered;
+
+    bool meteringEnabled = false;
+    float wetPeak = 0.0f;
+    double wetSquares = 0.0;
+    int wetNumSamples = 0;
+    int tapSampleMaxSize = 0;
     float delayTime = 15.0f;
     float roomSize = 30.0f;
     float mix = 1.0f;
@@ -14,6 +14,49 @@
 #define VALUE_MIN_ROOM_SIZE 0.0
 #define VALUE_MAX_ROOM_SIZE 500.0f
 
+#define GATE_MODE_OFF 0
+#define GATE_MODE_NOTE 1
+#define GATE_MODE_CC 2
+#define GATE_MODE_SIDECHAIN 3
+
+#define QUALITY_MODE_AUTO 0
+#define QUALITY_MODE_REALTIME 1
+#define QUALITY_MODE_OFFLINE 2
+
+// binary state: magic, version, number of values, hash of the parameter IDs, then the plain value of each parameter
+// in getParameters() order, followed by the parameter IDs in the same order
+// a state whose hash doesn't match (parameters added, removed or reordered since) is read back by ID
+#define STATE_MAGIC 0x52564754 // "RVGT"
+#define STATE_VERSION 2
+#define STATE_HEADER_SIZE 16
+#define STATE_HEADER_SIZE_V1 12 // version 1: no hash and no IDs, read by position
+
+namespace
+{
+    // QUALITY changes the history type, so the host can't automate it (it is switched at a block boundary, see handleAsyncUpdate)
+    class NonAutomatableChoice : public juce::AudioParameterChoice
+    {
+    public:
+        using juce::AudioParameterChoice::AudioParameterChoice;
+        bool isAutomatable() const override { return false; }
+    };
+
+    // xml states from older versions were saved under the plugin name, "REVERSE GATE" isn't a valid xml name and doesn't parse:
+    // the space is moved behind the name so the blob keeps its size
+    void renameLegacyStateTag (juce::MemoryBlock& xmlState)
+    {
+        const char* const renames[][2] = { { "<REVERSE GATE", "<REVERSEGATE " }, { "</REVERSE GATE", "</REVERSEGATE " } };
+        auto* begin = static_cast<char*> (xmlState.getData());
+        auto* end = begin + xmlState.getSize();
+        for (auto& rename : renames)
+        {
+            auto length = std::strlen (rename[0]);
+            auto* found = std::search (begin, end, rename[0], rename[0] + length);
+            if (found != end) std::memcpy (found, rename[1], length);
+        }
+    }
+}
+
 //==============================================================================
 REVERSEGATEAudioProcessor::REVERSEGATEAudioProcessor()
 #ifndef JucePlugin_PreferredChannelConfigurations
@@ -21,6 +64,7 @@ REVERSEGATEAudioProcessor::REVERSEGATEAudioProcessor()
                      #if ! JucePlugin_IsMidiEffect
                       #if ! JucePlugin_IsSynth
                        .withInput  ("Input",  juce::AudioChannelSet::stereo(), true)
+                       .withInput  ("Sidechain", juce::AudioChannelSet::stereo(), false)
                       #endif
                        .withOutput ("Output", juce::AudioChannelSet::stereo(), true)
                      #endif
@@ -28,12 +72,25 @@ REVERSEGATEAudioProcessor::REVERSEGATEAudioProcessor()
 #else 
     :
 #endif
-    parameters(*this, nullptr, juce::Identifier(JucePlugin_Name), // processor, undoManager, valueTreeType, parameterLayout
+    parameters(*this, nullptr, juce::Identifier("REVERSEGATE"), // processor, undoManager, valueTreeType, parameterLayout
     {
         std::make_unique<juce::AudioParameterFloat>("DELAY TIME", "DELAY TIME", juce::NormalisableRange<float>(VALUE_MIN_DELAY_TIME, VALUE_MAX_DELAY_TIME, 0.05), 30.0),
         std::make_unique<juce::AudioParameterFloat>("ROOM SIZE", "ROOM SIZE", juce::NormalisableRange<float>(VALUE_MIN_ROOM_SIZE, VALUE_MAX_ROOM_SIZE, 0.05), 15.0),
         std::make_unique<juce::AudioParameterFloat>("MIX", "MIX", juce::NormalisableRange<float>(0.0, 100.0, 0.1), 50.0),
         std::make_unique<juce::AudioParameterFloat>("VOLUME", "VOLUME", juce::NormalisableRange<float>(0.0, 1.0, 0.1), 0.8),
+        std::make_unique<juce::AudioParameterChoice>("GATE MODE", "GATE MODE", juce::StringArray { "OFF", "NOTE", "CC", "SIDECHAIN" }, GATE_MODE_OFF),
+        std::make_unique<juce::AudioParameterInt>("GATE CC", "GATE CC", 0, 127, 64),
+        std::make_unique<juce::AudioParameterBool>("BYPASS", "BYPASS", false),
+        std::make_unique<NonAutomatableChoice>("QUALITY", "QUALITY", juce::StringArray { "AUTO", "REALTIME", "OFFLINE" }, QUALITY_MODE_AUTO),
+        std::make_unique<juce::AudioParameterFloat>("WIDTH", "WIDTH", juce::NormalisableRange<float>(0.0, 100.0, 0.1), 0.0),
+        std::make_unique<juce::AudioParameterFloat>("SC THRESHOLD", "SC THRESHOLD", juce::NormalisableRange<float>(-60.0, 0.0, 0.1), -24.0),
+        std::make_unique<juce::AudioParameterFloat>("SC ATTACK", "SC ATTACK", juce::NormalisableRange<float>(0.1, 50.0, 0.1), 1.0),
+        std::make_unique<juce::AudioParameterFloat>("SC HOLD", "SC HOLD", juce::NormalisableRange<float>(0.0, 500.0, 1.0), 50.0),
+        std::make_unique<juce::AudioParameterFloat>("SC RELEASE", "SC RELEASE", juce::NormalisableRange<float>(1.0, 1000.0, 1.0), 100.0),
+        std::make_unique<juce::AudioParameterBool>("SYNC", "SYNC", false),
+        std::make_unique<juce::AudioParameterChoice>("DELAY NOTE", "DELAY NOTE", TempoTapTables::getNoteNames(VALUE_MAX_DELAY_TIME), 2),
+        std::make_unique<juce::AudioParameterChoice>("ROOM NOTE", "ROOM NOTE", TempoTapTables::getNoteNames(VALUE_MAX_ROOM_SIZE), 2),
+        std::make_unique<juce::AudioParameterBool>("LINEAR", "LINEAR", false),
 
     })    
 {
@@ -41,25 +98,73 @@ REVERSEGATEAudioProcessor::REVERSEGATEAudioProcessor()
     roomSizeParameter = parameters.getRawParameterValue("ROOM SIZE");
     mixParameter = parameters.getRawParameterValue("MIX");
     volumeParameter = parameters.getRawParameterValue("VOLUME");
+    gateModeParameter = parameters.getRawParameterValue("GATE MODE");
+    gateCCParameter = parameters.getRawParameterValue("GATE CC");
+    bypassParameter = parameters.getRawParameterValue("BYPASS");
+    qualityParameter = parameters.getRawParameterValue("QUALITY");
+    widthParameter = parameters.getRawParameterValue("WIDTH");
+    sidechainThresholdParameter = parameters.getRawParameterValue("SC THRESHOLD");
+    sidechainAttackParameter = parameters.getRawParameterValue("SC ATTACK");
+    sidechainHoldParameter = parameters.getRawParameterValue("SC HOLD");
+    sidechainReleaseParameter = parameters.getRawParameterValue("SC RELEASE");
+    syncParameter = parameters.getRawParameterValue("SYNC");
+    delayNoteParameter = parameters.getRawParameterValue("DELAY NOTE");
+    roomNoteParameter = parameters.getRawParameterValue("ROOM NOTE");
+    linearParameter = parameters.getRawParameterValue("LINEAR");
     listener = new ParameterListener(*this);
     parameters.addParameterListener("DELAY TIME", listener);
     parameters.addParameterListener("ROOM SIZE", listener);
     parameters.addParameterListener("MIX", listener);
     parameters.addParameterListener("VOLUME", listener);
-    
+    parameters.addParameterListener("QUALITY", listener);
+    parameters.addParameterListener("SYNC", listener);
+    parameters.addParameterListener("DELAY NOTE", listener);
+    parameters.addParameterListener("ROOM NOTE", listener);
+
+    presetBank.loadFromFile(PresetBank::getDefaultFile());
+
+    // the ID table written after the values of every state, and its hash for the header
+    juce::StringArray parameterIDs;
+    {
+        juce::MemoryOutputStream stream(stateParameterIDs, false);
+        for (auto* param : getParameters()) {
+            auto& paramID = static_cast<juce::RangedAudioParameter*>(param)->paramID;
+            parameterIDs.add(paramID);
+            stream.writeString(paramID);
+        }
+    }
+    stateParameterIDHash = parameterIDs.joinIntoString("\n").hashCode();
 }
 
 REVERSEGATEAudioProcessor::~REVERSEGATEAudioProcessor()
 {
+    cancelPendingUpdate();
     parameters.removeParameterListener("DELAY TIME", listener);
     parameters.removeParameterListener("ROOM SIZE", listener);
     parameters.removeParameterListener("MIX", listener);
     parameters.removeParameterListener("VOLUME", listener);
+    parameters.removeParameterListener("QUALITY", listener);
+    parameters.removeParameterListener("SYNC", listener);
+    parameters.removeParameterListener("DELAY NOTE", listener);
+    parameters.removeParameterListener("ROOM NOTE", listener);
     listener = nullptr;
     delayTimeParameter = nullptr;
     roomSizeParameter = nullptr;
     mixParameter = nullptr;
     volumeParameter = nullptr;
+    gateModeParameter = nullptr;
+    gateCCParameter = nullptr;
+    bypassParameter = nullptr;
+    qualityParameter = nullptr;
+    widthParameter = nullptr;
+    sidechainThresholdParameter = nullptr;
+    sidechainAttackParameter = nullptr;
+    sidechainHoldParameter = nullptr;
+    sidechainReleaseParameter = nullptr;
+    syncParameter = nullptr;
+    delayNoteParameter = nullptr;
+    roomNoteParameter = nullptr;
+    linearParameter = nullptr;
 }
 
 //==============================================================================
@@ -102,22 +207,36 @@ double REVERSEGATEAudioProcessor::getTailLengthSeconds() const
 
 int REVERSEGATEAudioProcessor::getNumPrograms()
 {
-    return 1;   // NB: some hosts don't cope very well if you tell them there are 0 programs,
-                // so this should be at least 1, even if you're not really implementing programs.
+    return juce::jmax(1, presetBank.size());   // NB: some hosts don't cope very well if you tell them there are 0 programs,
+                                               // so this should be at least 1, even if you're not really implementing programs.
 }
 
 int REVERSEGATEAudioProcessor::getCurrentProgram()
 {
-    return 0;
+    return currentProgram;
 }
 
 void REVERSEGATEAudioProcessor::setCurrentProgram (int index)
 {
+    if (! juce::isPositiveAndBelow(index, presetBank.size())) return;
+
+    // parameters follow the preset, but DELAY TIME / ROOM SIZE don't trigger a recalculation:
+    // processBlock swaps in the pre-compiled tap table and crossfades to it
+    auto preset = presetBank.getPreset(index);
+    programSwitchThread = juce::Thread::getCurrentThreadId();
+    setParameterValue("DELAY TIME", preset.delayTime);
+    setParameterValue("ROOM SIZE", preset.roomSize);
+    setParameterValue("MIX", preset.mix);
+    setParameterValue("VOLUME", preset.volume);
+    programSwitchThread = nullptr;
+
+    currentProgram = index;
+    pendingProgram = index;
 }
 
 const juce::String REVERSEGATEAudioProcessor::getProgramName (int index)
 {
-    return {};
+    return presetBank.getName(index);
 }
 
 void REVERSEGATEAudioProcessor::changeProgramName (int index, const juce::String& newName)
@@ -127,8 +246,101 @@ void REVERSEGATEAudioProcessor::changeProgramName (int index, const juce::String
 //==============================================================================
 void REVERSEGATEAudioProcessor::prepareToPlay (double sampleRate, int samplesPerBlock)
 {
-    // Use this method as the place to do any pre-playback
-    // initialisation that you need..
+    const juce::ScopedLock lock(qualityLock);
+
+    // tile size and history are sized here, so huge host blocks are processed in cache-sized tiles
+    resizeDelays();
+    for (int i = 0; i < delay.size(); i++) {
+        delay[i].setRoomSizeMax(VALUE_MAX_ROOM_SIZE);
+        delay[i].setDelayTimeMax(VALUE_MAX_DELAY_TIME);
+        delay[i].prepare(sampleRate, samplesPerBlock);
+
+        // the listener only reaches delays that already exist, so new ones (or a state loaded before the first prepare) start from the parameters here
+        if (! isSynced()) {
+            delay[i].setDelayTime(*delayTimeParameter);
+            delay[i].setRoomSize(*roomSizeParameter);
+        }
+        delay[i].setMix(*mixParameter);
+        delay[i].setVolume(*volumeParameter);
+    }
+    applyQuality();
+    visualiserFeed.prepare(sampleRate);
+    {
+        const juce::SpinLock::ScopedLockType responseLock(responseSettingsLock);
+        responseSettings.resize(delay.size());
+    }
+    publishResponseSettings();
+
+    // opt-in event recording to reproduce glitches: REVERSEGATE_RECORD=<file>, REVERSEGATE_RECORD_AUDIO=1 also keeps the input
+    // each instance writes its own <file>-<process>-<n>.<ext>
+    auto recordPath = juce::SystemStats::getEnvironmentVariable("REVERSEGATE_RECORD", {});
+    if (recordPath.isNotEmpty() && ! eventRecorder.isRecording())
+        eventRecorder.start(EventRecorder::getUniqueFile(juce::File::getCurrentWorkingDirectory().getChildFile(recordPath)),
+                            juce::SystemStats::getEnvironmentVariable("REVERSEGATE_RECORD_AUDIO", {}) == "1");
+    eventRecorder.recordPrepare(sampleRate, samplesPerBlock, juce::jmax(1, getMainBusNumInputChannels()), delay[0].getNumLanes(), VALUE_MAX_DELAY_TIME, VALUE_MAX_ROOM_SIZE);
+
+    dryBuffer.setSize(getMainBusNumInputChannels(), juce::jmax(1, samplesPerBlock));
+    envelopeFollower.prepare(sampleRate, samplesPerBlock);
+    bypassGain.reset(sampleRate, 0.01);
+    bypassGain.setCurrentAndTargetValue(*bypassParameter >= 0.5f ? 1.0f : 0.0f);
+
+    // compile every preset's tap table now, so a program change never calculates on the audio thread
+    programTapTables.resize(presetBank.size() * delay.size());
+    for (int program = 0; program < presetBank.size(); program++) {
+        auto preset = presetBank.getPreset(program);
+        auto delayTime = snapParameterValue("DELAY TIME", preset.delayTime);
+        auto roomSize = snapParameterValue("ROOM SIZE", preset.roomSize);
+        for (int i = 0; i < delay.size(); i++)
+            programTapTables[program * delay.size() + i] = delay[i].compileTapTable(delayTime, roomSize);
+    }
+
+    // same for every quantised host tempo, but only once SYNC has been turned on; note changes are rebuilt later on the tables' own thread
+    tempoTapTables.setNotes((int) delayNoteParameter->load(), (int) roomNoteParameter->load());
+    if (isSynced()) tempoTapTables.enable();
+    tempoTapTables.prepare(sampleRate, VALUE_MAX_DELAY_TIME, VALUE_MAX_ROOM_SIZE);
+    tempoTapTableKey = -1;
+}
+
+// AUTO follows the host: interpolated taps and double history while rendering offline
+MultiTapDelay::Quality REVERSEGATEAudioProcessor::getTargetQuality() const
+{
+    auto quality = (int) qualityParameter->load();
+    if (quality == QUALITY_MODE_AUTO) quality = isNonRealtime() ? QUALITY_MODE_OFFLINE : QUALITY_MODE_REALTIME;
+    return quality == QUALITY_MODE_OFFLINE ? MultiTapDelay::QUALITY_OFFLINE : MultiTapDelay::QUALITY_REALTIME;
+}
+
+// prepareToPlay only (not processing): switches directly and cancels a pending switch
+void REVERSEGATEAudioProcessor::applyQuality()
+{
+    auto quality = getTargetQuality();
+    for (int i = 0; i < delay.size(); i++) {
+        delay[i].setQuality(quality);
+        delay[i].releaseSpareHistory();
+    }
+    qualitySwitch = QUALITY_SWITCH_NONE;
+}
+
+// QUALITY changed (or the last switch finished): allocate here, processBlock only copies
+// SYNC / DELAY NOTE / ROOM NOTE changed: start or wake the tempo tables' thread
+void REVERSEGATEAudioProcessor::handleAsyncUpdate()
+{
+    tempoTapTables.setNotes((int) delayNoteParameter->load(), (int) roomNoteParameter->load());
+    if (isSynced()) tempoTapTables.enable();
+
+    const juce::ScopedLock lock(qualityLock);
+    if (delay.empty()) return;
+
+    if (qualitySwitch == QUALITY_SWITCH_DONE) {
+        for (int i = 0; i < delay.size(); i++) delay[i].releaseSpareHistory();
+        qualitySwitch = QUALITY_SWITCH_NONE;
+    }
+    // READY: the switch is still pending, this runs again once it is done
+    auto quality = getTargetQuality();
+    if (qualitySwitch == QUALITY_SWITCH_NONE && quality != delay[0].getQuality()) {
+        for (int i = 0; i < delay.size(); i++) delay[i].reserveQuality(quality);
+        pendingQuality = quality;
+        qualitySwitch = QUALITY_SWITCH_READY;
+    }
 }
 
 void REVERSEGATEAudioProcessor::releaseResources()
@@ -156,6 +368,13 @@ bool REVERSEGATEAudioProcessor::isBusesLayoutSupported (const BusesLayout& layou
    #if ! JucePlugin_IsSynth
     if (layouts.getMainOutputChannelSet() != layouts.getMainInputChannelSet())
         return false;
+
+    // optional sidechain: off, mono or stereo
+    if (layouts.inputBuses.size() > 1) {
+        auto sidechain = layouts.getChannelSet(true, 1);
+        if (! sidechain.isDisabled() && sidechain != juce::AudioChannelSet::mono() && sidechain != juce::AudioChannelSet::stereo())
+            return false;
+    }
    #endif
 
     return true;
@@ -165,25 +384,322 @@ bool REVERSEGATEAudioProcessor::isBusesLayoutSupported (const BusesLayout& layou
 
 void REVERSEGATEAudioProcessor::processBlock (juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
 {
+    RG_TRACE_SCOPE("processBlock");
     juce::ScopedNoDenormals noDenormals;
-    auto totalNumInputChannels  = getTotalNumInputChannels();
+    auto totalNumInputChannels  = getMainBusNumInputChannels(); // the sidechain bus is never processed
     auto totalNumOutputChannels = getTotalNumOutputChannels();
     juce::int32 numSamples = buffer.getNumSamples();
 
     for (auto i = totalNumInputChannels; i < totalNumOutputChannels; ++i)
         buffer.clear (i, 0, buffer.getNumSamples());
         
-    if (totalNumInputChannels > 0) delay.resize(totalNumInputChannels);
+    if (totalNumInputChannels > 0) resizeDelays();
     for (int i = 0; i < delay.size(); i++) {
         delay[i].setSampleRate(getSampleRate());
         delay[i].setRoomSizeMax(VALUE_MAX_ROOM_SIZE);
         delay[i].setDelayTimeMax(VALUE_MAX_DELAY_TIME);
     }
+    delay[0].setWidth(*widthParameter);
+    for (int i = 0; i < delay.size(); i++) delay[i].setLinear(*linearParameter >= 0.5f);
+
+    // QUALITY: the other history type is already allocated, switching only copies the history
+    if (qualitySwitch == QUALITY_SWITCH_READY) {
+        for (int i = 0; i < delay.size(); i++) delay[i].setQuality(pendingQuality);
+        qualitySwitch = QUALITY_SWITCH_DONE;
+        triggerAsyncUpdate();
+    }
+    recordBlock(buffer);
+
+    auto program = pendingProgram.exchange(-1);
+    if (program >= 0 && ! isSynced() && (program + 1) * delay.size() <= programTapTables.size()) {
+        for (int i = 0; i < delay.size(); i++)
+            delay[i].switchTapTable(programTapTables[program * delay.size() + i]);
+        // host automation that arrived while the program was switching wins, the same way as changing them by hand
+        if (*delayTimeParameter != delay[0].getDelayTime() || *roomSizeParameter != delay[0].getRoomSize()) {
+            for (int i = 0; i < delay.size(); i++) {
+                delay[i].setDelayTime(*delayTimeParameter);
+                delay[i].setRoomSize(*roomSizeParameter);
+            }
+        }
+        eventRecorder.recordTapTable(delay[0].getDelayTime(), delay[0].getRoomSize());
+    }
+
+    // synced: crossfade to the pre-compiled table whenever the quantised tempo (or the note) changes,
+    // a tempo ramp never fades the wet signal out or calculates on the audio thread
+    if (isSynced()) {
+        MultiTapDelay::TapTable table;
+        if (tempoTapTables.getTapTableIfChanged(getHostTempo(), tempoTapTableKey, table)) {
+            for (int i = 0; i < delay.size(); i++) delay[i].switchTapTable(table);
+            eventRecorder.recordTapTable(delay[0].getDelayTime(), delay[0].getRoomSize());
+        }
+    }
+    else if (tempoTapTableKey >= 0) {
+        // back to DELAY TIME / ROOM SIZE, the same way as changing them by hand
+        tempoTapTableKey = -1;
+        for (int i = 0; i < delay.size(); i++) {
+            delay[i].setDelayTime(*delayTimeParameter);
+            delay[i].setRoomSize(*roomSizeParameter);
+        }
+    }
     
-    for (int channel = 0; channel < totalNumInputChannels; ++channel)
+    // gate follows MIDI notes, one CC or the sidechain level, the block is split only at the events that open or close it
+    auto gateMode = (int) gateModeParameter->load();
+    if (gateMode != lastGateMode) {
+        lastGateMode = gateMode;
+        heldNotes = 0;
+        envelopeFollower.reset();
+        gateOpen = (gateMode == GATE_MODE_OFF);
+        for (int i = 0; i < delay.size(); i++) delay[i].setGate(gateOpen, false);
+        eventRecorder.recordGate(0, gateOpen, false);
+    }
+
+    publishResponseSettings();
+
+    // fully bypassed: only keep the history warm, audio passes through untouched
+    bypassGain.setTargetValue(*bypassParameter >= 0.5f ? 1.0f : 0.0f);
+    if (! bypassGain.isSmoothing() && bypassGain.getCurrentValue() == 1.0f) {
+        eventRecorder.recordBypass();
+        pushHistory(buffer);
+        eventRecorder.recordFadeStates(delay);
+        return;
+    }
+    // metering only runs while the editor shows the visualiser
+    bool showVisualiser = visualiserFeed.isActive();
+    for (int i = 0; i < delay.size(); i++) delay[i].setMeteringEnabled(showVisualiser);
+
+    int startSample = 0;
+    if (gateMode == GATE_MODE_SIDECHAIN) {
+        // the follower runs over the whole sidechain block first, in chunks, and only reports where the gate changes
+        envelopeFollower.setParameters(*sidechainThresholdParameter, *sidechainAttackParameter,
+                                       *sidechainHoldParameter, *sidechainReleaseParameter);
+        auto numEvents = getBusCount(true) > 1 ? envelopeFollower.process(getBusBuffer(buffer, true, 1), numSamples) : 0;
+        for (int i = 0; i < numEvents; i++) {
+            const auto& event = envelopeFollower.getEvent(i);
+            gateOpen = event.open;
+            splitAtGate(buffer, startSample, juce::jlimit(startSample, numSamples, event.samplePosition), event.open);
+        }
+    }
+    else if (gateMode != GATE_MODE_OFF) {
+        for (const auto metadata : midiMessages) {
+            auto event = getGateEvent(metadata.getMessage(), gateMode);
+            if (event == GATE_NONE) continue;
+            splitAtGate(buffer, startSample, juce::jlimit(startSample, numSamples, metadata.samplePosition), event == GATE_OPEN);
+        }
+    }
+    processSubBlock(buffer, startSample, numSamples - startSample);
+    eventRecorder.recordFadeStates(delay);
+
+    if (showVisualiser) {
+        RG_TRACE_SCOPE("visualiserFeed");
+        visualiserFeed.push(delay);
+    }
+}
+
+void REVERSEGATEAudioProcessor::processBlockBypassed (juce::AudioBuffer<float>& buffer, juce::MidiBuffer&)
+{
+    // host bypass: same cheap path, and fade back in when processBlock is called again
+    RG_TRACE_SCOPE("processBlockBypassed");
+    for (auto i = getMainBusNumInputChannels(); i < getTotalNumOutputChannels(); ++i)
+        buffer.clear (i, 0, buffer.getNumSamples());
+    recordBlock(buffer);
+    eventRecorder.recordBypass();
+    pushHistory(buffer);
+    eventRecorder.recordFadeStates(delay);
+    bypassGain.setCurrentAndTargetValue(1.0f);
+}
+
+void REVERSEGATEAudioProcessor::pushHistory (juce::AudioBuffer<float>& buffer)
+{
+    if (isStereoPair()) {
+        delay[0].pushHistory(buffer.getReadPointer(0), buffer.getReadPointer(1), buffer.getNumSamples());
+        return;
+    }
+    for (int channel = 0; channel < juce::jmin(getMainBusNumInputChannels(), (int) delay.size()); ++channel)
+        delay[channel].pushHistory(buffer.getReadPointer(channel), buffer.getNumSamples());
+}
+
+// last known host tempo, kept while the host doesn't report one
+double REVERSEGATEAudioProcessor::getHostTempo()
+{
+    juce::AudioPlayHead::CurrentPositionInfo position;
+    if (auto* playHead = getPlayHead())
+        if (playHead->getCurrentPosition(position) && position.bpm > 0.0) hostTempo = position.bpm;
+    return hostTempo;
+}
+
+// a stereo input is processed as one L/R pair by delay[0], at WIDTH 0 that sounds exactly like two mono delays
+// nothing is reallocated while the layout stays the same
+void REVERSEGATEAudioProcessor::resizeDelays()
+{
+    auto numChannels = juce::jmax(1, getMainBusNumInputChannels());
+    delay.resize(numChannels == 2 ? 1 : numChannels);
+    for (int i = 0; i < delay.size(); i++) delay[i].setNumLanes(numChannels == 2 ? 2 : 1);
+}
+
+bool REVERSEGATEAudioProcessor::isStereoPair() const
+{
+    return delay.size() == 1 && delay[0].getNumLanes() == 2 && getMainBusNumInputChannels() == 2;
+}
+
+void REVERSEGATEAudioProcessor::recordBlock (const juce::AudioBuffer<float>& buffer)
+{
+    // values MultiTapDelay actually runs with, so EventRecorder::replay() can re-run the block exactly
+    if (! eventRecorder.isRecording() || delay.empty()) return;
+    auto flags = (delay[0].getQuality() == MultiTapDelay::QUALITY_OFFLINE ? EventRecorder::BLOCK_QUALITY_OFFLINE : 0)
+               | (delay[0].isLinear() ? EventRecorder::BLOCK_LINEAR : 0);
+    eventRecorder.recordBlock(buffer, juce::jmax(1, getMainBusNumInputChannels()), delay[0].getDelayTime(), delay[0].getRoomSize(),
+                              delay[0].getMix(), delay[0].getVolume(), flags);
+    eventRecorder.recordWidth(delay[0].getWidth());
+}
+
+// skipped when the message thread holds the lock or the layout changed without prepareToPlay, the next block publishes again
+void REVERSEGATEAudioProcessor::publishResponseSettings()
+{
+    juce::SpinLock::ScopedTryLockType lock(responseSettingsLock);
+    if (! lock.isLocked() || responseSettings.size() != delay.size()) return;
+    for (int i = 0; i < delay.size(); i++) responseSettings[i] = delay[i].getResponseSettings();
+}
+
+// computed from the published settings, nothing is rendered; with LINEAR on, processBlock is exactly this FIR
+bool REVERSEGATEAudioProcessor::exportImpulseResponse (const juce::File& file)
+{
+    std::vector<MultiTapDelay::ResponseSettings> settings;
+    {
+        const juce::SpinLock::ScopedLockType lock(responseSettingsLock);
+        settings = responseSettings;
+    }
+    if (settings.empty()) return false;
+
+    std::vector<std::vector<float>> responses;
+    for (auto& s : settings) {
+        for (int lane = 0; lane < s.numLanes; lane++)
+            responses.push_back(MultiTapDelay::getImpulseResponse(s, lane));
+    }
+    responses.resize(juce::jmin(responses.size(), (size_t) getMainBusNumInputChannels()));
+    if (responses.empty()) return false;
+
+    size_t length = 0;
+    for (auto& response : responses) length = juce::jmax(length, response.size());
+    juce::AudioBuffer<float> buffer((int) responses.size(), (int) length);
+    buffer.clear();
+    for (int channel = 0; channel < buffer.getNumChannels(); ++channel)
+        buffer.copyFrom(channel, 0, responses[channel].data(), (int) responses[channel].size());
+
+    file.deleteFile();
+    std::unique_ptr<juce::FileOutputStream> stream(file.createOutputStream());
+    if (stream == nullptr) return false;
+
+    if (file.hasFileExtension("wav")) {
+        juce::WavAudioFormat format;
+        std::unique_ptr<juce::AudioFormatWriter> writer(format.createWriterFor(stream.get(), getSampleRate(), (unsigned int) buffer.getNumChannels(), 32, {}, 0));
+        if (writer == nullptr) return false;
+        stream.release(); // the writer owns it now
+        return writer->writeFromAudioSampleBuffer(buffer, 0, buffer.getNumSamples());
+    }
+
+    // raw: 32-bit float, little endian, channels interleaved
+    for (int i = 0; i < buffer.getNumSamples(); ++i)
+        for (int channel = 0; channel < buffer.getNumChannels(); ++channel)
+            stream->writeFloat(buffer.getSample(channel, i));
+    return stream->getStatus().wasOk();
+}
+
+juce::AudioProcessorParameter* REVERSEGATEAudioProcessor::getBypassParameter() const
+{
+    return parameters.getParameter("BYPASS");
+}
+
+void REVERSEGATEAudioProcessor::processSubBlock (juce::AudioBuffer<float>& buffer, int startSample, int numSamples)
+{
+    if (numSamples <= 0) return;
+    if (! bypassGain.isSmoothing() && bypassGain.getCurrentValue() == 0.0f) {
+        processDelays(buffer, startSample, numSamples);
+        return;
+    }
+
+    // BYPASS ramps (or finished ramping to bypassed earlier in this block): keep the input in dryBuffer and mix it back in,
+    // in chunks of the size allocated in prepareToPlay so a host block larger than announced never allocates
+    auto numChannels = juce::jmin(dryBuffer.getNumChannels(), buffer.getNumChannels());
+    for (int done = 0; done < numSamples;) {
+        auto start = startSample + done;
+        auto n = juce::jmin(numSamples - done, dryBuffer.getNumSamples());
+        for (int channel = 0; channel < numChannels; ++channel)
+            dryBuffer.copyFrom(channel, 0, buffer, channel, start, n);
+        processDelays(buffer, start, n);
+
+        RG_TRACE_SCOPE("bypassCrossfade");
+        for (int i = 0; i < n; i++) {
+            auto dryGain = bypassGain.getNextValue();
+            for (int channel = 0; channel < numChannels; ++channel) {
+                auto* out = buffer.getWritePointer(channel, start);
+                out[i] = out[i] * (1.0f - dryGain) + dryBuffer.getSample(channel, i) * dryGain;
+            }
+        }
+        done += n;
+    }
+}
+
+void REVERSEGATEAudioProcessor::processDelays (juce::AudioBuffer<float>& buffer, int startSample, int numSamples)
+{
+    if (isStereoPair()) {
+        delay[0].processPair(buffer, startSample, numSamples);
+        return;
+    }
+    for (int channel = 0; channel < juce::jmin(getMainBusNumInputChannels(), (int) delay.size()); ++channel)
     {
-        delay[channel].process(buffer, channel, numSamples);
+        delay[channel].process(buffer, channel, startSample, numSamples);
+    }
+}
+
+// process up to the event, then open (and retrigger) or close the gate from that sample on
+void REVERSEGATEAudioProcessor::splitAtGate (juce::AudioBuffer<float>& buffer, int& startSample, int eventSample, bool open)
+{
+    processSubBlock(buffer, startSample, eventSample - startSample);
+    startSample = eventSample;
+    for (int i = 0; i < delay.size(); i++) delay[i].setGate(open, open);
+    eventRecorder.recordGate(eventSample, open, open);
+}
+
+REVERSEGATEAudioProcessor::GateEvent REVERSEGATEAudioProcessor::getGateEvent (const juce::MidiMessage& message, int gateMode)
+{
+    if (gateMode == GATE_MODE_NOTE) {
+        // every note-on retriggers, the gate closes when the last note is released
+        if (message.isNoteOn()) {
+            heldNotes++;
+            gateOpen = true;
+            return GATE_OPEN;
+        }
+        if (message.isNoteOff() && heldNotes > 0 && --heldNotes == 0) {
+            gateOpen = false;
+            return GATE_CLOSE;
+        }
+        if (message.isAllNotesOff() && gateOpen) {
+            heldNotes = 0;
+            gateOpen = false;
+            return GATE_CLOSE;
+        }
+    }
+    else if (gateMode == GATE_MODE_CC && message.isControllerOfType((int) gateCCParameter->load())) {
+        bool open = message.getControllerValue() >= 64;
+        if (open == gateOpen) return GATE_NONE;
+        gateOpen = open;
+        return open ? GATE_OPEN : GATE_CLOSE;
     }
+    return GATE_NONE;
+}
+
+//==============================================================================
+void REVERSEGATEAudioProcessor::setParameterValue (const juce::String& parameterID, float value)
+{
+    if (auto* param = parameters.getParameter(parameterID))
+        param->setValueNotifyingHost(param->convertTo0to1(value));
+}
+
+float REVERSEGATEAudioProcessor::snapParameterValue (const juce::String& parameterID, float value)
+{
+    if (auto* param = parameters.getParameter(parameterID))
+        return param->convertFrom0to1(param->convertTo0to1(value));
+    return value;
 }
 
 //==============================================================================
@@ -200,16 +716,67 @@ juce::AudioProcessorEditor* REVERSEGATEAudioProcessor::createEditor()
 //==============================================================================
 void REVERSEGATEAudioProcessor::getStateInformation (juce::MemoryBlock& destData)
 {
-    // load from xml
-    auto state = parameters.copyState();
-    std::unique_ptr<juce::XmlElement> xml (state.createXml());
-    copyXmlToBinary (*xml, destData);
+    // fixed-layout binary, no xml
+    auto& params = getParameters();
+    destData.setSize (STATE_HEADER_SIZE + sizeof (float) * (size_t) params.size() + stateParameterIDs.getSize());
+
+    juce::MemoryOutputStream stream (destData, false);
+    stream.writeInt (STATE_MAGIC);
+    stream.writeInt (STATE_VERSION);
+    stream.writeInt (params.size());
+    stream.writeInt (stateParameterIDHash);
+    for (auto* param : params)
+    {
+        auto* ranged = static_cast<juce::RangedAudioParameter*> (param);
+        stream.writeFloat (ranged->convertFrom0to1 (ranged->getValue()));
+    }
+    stream.write (stateParameterIDs.getData(), stateParameterIDs.getSize());
 }
 
 void REVERSEGATEAudioProcessor::setStateInformation (const void* data, int sizeInBytes)
 {
-    // save to xml
-    std::unique_ptr<juce::XmlElement> xmlState (getXmlFromBinary (data, sizeInBytes));
+    if (sizeInBytes >= STATE_HEADER_SIZE_V1
+         && juce::ByteOrder::littleEndianInt (data) == STATE_MAGIC)
+    {
+        juce::MemoryInputStream stream (data, (size_t) sizeInBytes, false);
+        stream.skipNextBytes (4);
+        auto version = stream.readInt();
+        auto headerSize = version >= 2 ? STATE_HEADER_SIZE : STATE_HEADER_SIZE_V1;
+        if (version > STATE_VERSION || sizeInBytes < headerSize)
+            return;
+
+        auto& params = getParameters();
+        auto numStored = juce::jlimit (0, (sizeInBytes - headerSize) / (int) sizeof (float), stream.readInt());
+        auto idHash = version >= 2 ? stream.readInt() : stateParameterIDHash;
+        if (idHash == stateParameterIDHash)
+        {
+            // the same parameters in the same order (version 1 states are read by position too)
+            // states from older builds may have fewer values, the rest are left as they are
+            auto numValues = juce::jmin (numStored, params.size());
+            for (int i = 0; i < numValues; i++)
+            {
+                auto* ranged = static_cast<juce::RangedAudioParameter*> (params[i]);
+                ranged->setValueNotifyingHost (ranged->convertTo0to1 (stream.readFloat()));
+            }
+            return;
+        }
+
+        // the parameters changed since the state was saved: match the values by ID, unknown IDs are skipped
+        auto idsStart = headerSize + numStored * (int) sizeof (float);
+        juce::MemoryInputStream ids (static_cast<const char*> (data) + idsStart, (size_t) (sizeInBytes - idsStart), false);
+        for (int i = 0; i < numStored && ! ids.isExhausted(); i++)
+        {
+            auto value = stream.readFloat();
+            if (auto* ranged = parameters.getParameter (ids.readString()))
+                ranged->setValueNotifyingHost (ranged->convertTo0to1 (value));
+        }
+        return;
+    }
+
+    // xml blobs saved by older versions
+    juce::MemoryBlock xmlData (data, (size_t) sizeInBytes);
+    renameLegacyStateTag (xmlData);
+    std::unique_ptr<juce::XmlElement> xmlState (getXmlFromBinary (xmlData.getData(), (int) xmlData.getSize()));
  
     if (xmlState.get() != nullptr) 
     {
@@ -10,11 +10,18 @@
 
 #include <JuceHeader.h>
 #include "MultiTapDelay.h"
+#include "VisualiserFeed.h"
+#include "PresetBank.h"
+#include "EventRecorder.h"
+#include "Trace.h"
+#include "EnvelopeFollower.h"
+#include "TempoTapTables.h"
 
 //==============================================================================
 /**
 */
-class REVERSEGATEAudioProcessor  : public juce::AudioProcessor
+class REVERSEGATEAudioProcessor  : public juce::AudioProcessor,
+                                   private juce::AsyncUpdater
 {
 public:
     //==============================================================================
@@ -30,6 +37,8 @@ public:
    #endif
 
     void processBlock (juce::AudioBuffer<float>&, juce::MidiBuffer&) override;
+    void processBlockBypassed (juce::AudioBuffer<float>&, juce::MidiBuffer&) override;
+    juce::AudioProcessorParameter* getBypassParameter() const override;
 
     //==============================================================================
     juce::AudioProcessorEditor* createEditor() override;
@@ -54,21 +63,120 @@ public:
     void getStateInformation (juce::MemoryBlock& destData) override;
     void setStateInformation (const void* data, int sizeInBytes) override;
 
+    // impulse response of the settings published by the last processBlock, one channel per input channel:
+    // .wav (32-bit float) or raw interleaved float; safe to call from any thread while audio runs
+    bool exportImpulseResponse (const juce::File& file);
+
     juce::AudioProcessorValueTreeState parameters;
+    VisualiserFeed visualiserFeed;
 
 private:
+    enum GateEvent
+    {
+        GATE_NONE = 0,
+        GATE_OPEN,
+        GATE_CLOSE
+    };
+    void processSubBlock (juce::AudioBuffer<float>& buffer, int startSample, int numSamples);
+    void processDelays (juce::AudioBuffer<float>& buffer, int startSample, int numSamples);
+    void splitAtGate (juce::AudioBuffer<float>& buffer, int& startSample, int eventSample, bool open);
+    void pushHistory (juce::AudioBuffer<float>& buffer);
+    void recordBlock (const juce::AudioBuffer<float>& buffer);
+    void resizeDelays();
+    void publishResponseSettings();
+    bool isStereoPair() const;
+    bool isSynced() const { return *syncParameter >= 0.5f; }
+    double getHostTempo();
+    GateEvent getGateEvent (const juce::MidiMessage& message, int gateMode);
+    void setParameterValue (const juce::String& parameterID, float value);
+    float snapParameterValue (const juce::String& parameterID, float value);
+    void applyQuality();
+    MultiTapDelay::Quality getTargetQuality() const;
+    void handleAsyncUpdate() override;
+
+    // one per input channel, except a stereo input: one L/R pair in delay[0]
     std::vector<MultiTapDelay> delay;
 
+    // presets: tap tables are compiled in prepareToPlay, [program * delay.size() + i]
+    PresetBank presetBank;
+    std::vector<MultiTapDelay::TapTable> programTapTables;
+    std::atomic<int> currentProgram { 0 };
+    std::atomic<int> pendingProgram { -1 };
+    std::atomic<juce::Thread::ThreadID> programSwitchThread { nullptr }; // set while setCurrentProgram writes the preset's parameters
+
+    // state: the parameter IDs as written after the values, and their hash for the header
+    juce::MemoryBlock stateParameterIDs;
+    int stateParameterIDHash = 0;
+
     juce::AudioProcessorValueTreeState::Listener* listener;
     std::atomic<float>* delayTimeParameter = nullptr;
     std::atomic<float>* roomSizeParameter = nullptr;
     std::atomic<float>* mixParameter = nullptr;
     std::atomic<float>* volumeParameter = nullptr;
+    std::atomic<float>* gateModeParameter = nullptr;
+    std::atomic<float>* gateCCParameter = nullptr;
+    std::atomic<float>* bypassParameter = nullptr;
+    std::atomic<float>* qualityParameter = nullptr;
+    std::atomic<float>* widthParameter = nullptr;
+    std::atomic<float>* sidechainThresholdParameter = nullptr;
+    std::atomic<float>* sidechainAttackParameter = nullptr;
+    std::atomic<float>* sidechainHoldParameter = nullptr;
+    std::atomic<float>* sidechainReleaseParameter = nullptr;
+    std::atomic<float>* syncParameter = nullptr;
+    std::atomic<float>* delayNoteParameter = nullptr;
+    std::atomic<float>* roomNoteParameter = nullptr;
+    std::atomic<float>* linearParameter = nullptr;
+
+    // QUALITY: the message thread allocates the other history type (READY), processBlock switches
+    // at a block boundary by copying (DONE), then the message thread frees the old history
+    enum QualitySwitch
+    {
+        QUALITY_SWITCH_NONE = 0,
+        QUALITY_SWITCH_READY,
+        QUALITY_SWITCH_DONE
+    };
+    std::atomic<int> qualitySwitch { QUALITY_SWITCH_NONE };
+    MultiTapDelay::Quality pendingQuality = MultiTapDelay::QUALITY_REALTIME;
+    juce::CriticalSection qualityLock; // handleAsyncUpdate vs prepareToPlay
+
+    // exportImpulseResponse() reads this copy of every delay's settings, the audio thread publishes it with a try-lock (like VisualiserFeed's tap table)
+    juce::SpinLock responseSettingsLock;
+    std::vector<MultiTapDelay::ResponseSettings> responseSettings;
+
+    // SYNC: tap tables for every quantised tempo, rebuilt off the audio thread (nothing is built until SYNC is first turned on)
+    TempoTapTables tempoTapTables;
+
+    // 1 = bypassed, ramps over 10 ms; dryBuffer holds the input while it ramps, one chunk of at most the prepared block size at a time
+    juce::LinearSmoothedValue<float> bypassGain;
+    juce::AudioBuffer<float> dryBuffer;
+
+    EventRecorder eventRecorder;
+   #if REVERSEGATE_ENABLE_TRACE
+    juce::SharedResourcePointer<Trace::Writer> traceWriter;
+   #endif
+
+    // audio thread only
+    EnvelopeFollower envelopeFollower;
+    int lastGateMode = -1;
+    juce::int64 tempoTapTableKey = -1;
+    double hostTempo = 120.0;
+    int heldNotes = 0;
+    bool gateOpen = true;
     
     class ParameterListener : public juce::AudioProcessorValueTreeState::Listener {
         public:
         ParameterListener(REVERSEGATEAudioProcessor& _p) : p(_p){}
         void parameterChanged(const juce::String& parameterID, float newValue) override {
+            // on program change or while synced the tap table is switched with a crossfade in processBlock instead
+            // (only setCurrentProgram's own notifications are skipped, host automation from other threads still goes through)
+            bool fromProgramSwitch = p.programSwitchThread.load() == juce::Thread::getCurrentThreadId();
+            if ((fromProgramSwitch || p.isSynced()) && (parameterID == "DELAY TIME" || parameterID == "ROOM SIZE")) return;
+            // the history changes type: allocated on the message thread, switched in processBlock
+            // SYNC / notes: the tempo tables are started and woken from the message thread too
+            if (parameterID == "QUALITY" || parameterID == "SYNC" || parameterID == "DELAY NOTE" || parameterID == "ROOM NOTE") {
+                p.triggerAsyncUpdate();
+                return;
+            }
             for (int i = 0; i < p.delay.size(); i++) {
                 if (parameterID == "DELAY TIME") p.delay[i].setDelayTime(newValue);
                 else if (parameterID == "ROOM SIZE") p.delay[i].setRoomSize(newValue);
@@ -0,0 +1,114 @@
+/*
+  ==============================================================================
+
+    PresetBank.cpp
+
+  ==============================================================================
+*/
+
+#include "PresetBank.h"
+
+#define BANK_MAGIC 0x4b424752 // "RGBK"
+#define BANK_VERSION 1
+#define BANK_HEADER_SIZE 12
+
+namespace
+{
+    // name, delayTime, roomSize, mix, volume
+    const struct { const char* name; float values[4]; } factoryPresets[] =
+    {
+        { "Default",     { 30.0f,  15.0f,  50.0f, 0.8f } },
+        { "Tight Swell", { 5.0f,   4.0f,   60.0f, 0.8f } },
+        { "Snare Gate",  { 15.0f,  12.0f,  70.0f, 0.8f } },
+        { "Big Room",    { 30.0f,  60.0f,  60.0f, 0.7f } },
+        { "Long Hall",   { 50.0f,  200.0f, 80.0f, 0.6f } },
+        { "Wet Only",    { 30.0f,  30.0f,  100.0f, 0.7f } },
+    };
+
+    // delayTime, roomSize, mix, volume の範囲 (processorのパラメータと同じ)
+    const float valueMin[4] = { 0.0f,  0.0f,   0.0f,   0.0f };
+    const float valueMax[4] = { 50.0f, 500.0f, 100.0f, 1.0f };
+}
+
+PresetBank::PresetBank()
+{
+    numPresets = (int) juce::numElementsInArray (factoryPresets);
+}
+
+bool PresetBank::loadFromFile (const juce::File& file)
+{
+    if (! file.existsAsFile())
+        return false;
+
+    auto mapped = std::make_unique<juce::MemoryMappedFile> (file, juce::MemoryMappedFile::readOnly);
+    auto* data = static_cast<const char*> (mapped->getData());
+    auto dataSize = (int) mapped->getSize();
+    if (data == nullptr || dataSize < BANK_HEADER_SIZE
+         || juce::ByteOrder::littleEndianInt (data) != BANK_MAGIC
+         || juce::ByteOrder::littleEndianInt (data + 4) > BANK_VERSION)
+        return false;
+
+    auto count = (int) juce::ByteOrder::littleEndianInt (data + 8);
+    count = juce::jmin (count, (dataSize - BANK_HEADER_SIZE) / (int) sizeof (Entry));
+    if (count <= 0)
+        return false;
+
+    mappedFile = std::move (mapped);
+    entries = data + BANK_HEADER_SIZE;
+    numPresets = count;
+    return true;
+}
+
+juce::File PresetBank::getDefaultFile()
+{
+    return juce::File::getSpecialLocation (juce::File::userApplicationDataDirectory)
+             .getChildFile (JucePlugin_Manufacturer)
+             .getChildFile (JucePlugin_Name)
+             .getChildFile ("Presets.rgbank");
+}
+
+juce::String PresetBank::getName (int index) const
+{
+    if (! juce::isPositiveAndBelow (index, numPresets))
+        return {};
+
+    if (entries == nullptr)
+        return factoryPresets[index].name;
+
+    auto* name = getEntry (index) + offsetof (Entry, name);
+    return juce::String::fromUTF8 (name, (int) strnlen (name, sizeof (Entry::name)));
+}
+
+PresetBank::Preset PresetBank::getPreset (int index) const
+{
+    index = juce::jlimit (0, numPresets - 1, index);
+    if (entries == nullptr)
+    {
+        auto& values = factoryPresets[index].values;
+        return { getName (index), values[0], values[1], values[2], values[3] };
+    }
+
+    // ファイルの値はそのまま使わない (壊れたファイル, 手で書いたファイル)
+    // NaN/infはDefaultの値に, 範囲外は範囲内に丸める
+    float values[4];
+    for (int i = 0; i < 4; i++)
+    {
+        auto value = getEntryValue (index, i);
+        values[i] = std::isfinite (value) ? juce::jlimit (valueMin[i], valueMax[i], value)
+                                          : factoryPresets[0].values[i];
+    }
+    return { getName (index), values[0], values[1], values[2], values[3] };
+}
+
+const char* PresetBank::getEntry (int index) const
+{
+    return entries + (size_t) index * sizeof (Entry);
+}
+
+float PresetBank::getEntryValue (int index, int value) const
+{
+    auto bits = juce::ByteOrder::littleEndianInt (getEntry (index) + offsetof (Entry, values) + (size_t) value * sizeof (float));
+    float result;
+    std::memcpy (&result, &bits, sizeof (result));
+    return result;
+}
@@ -0,0 +1,55 @@
+/*
+  ==============================================================================
+
+    PresetBank.h
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+
+// プリセット一覧, ファイルはメモリマップして必要なエントリだけ読む
+// ファイル形式 (little endian):
+//   "RGBK", version(uint32), numPresets(uint32)
+//   numPresets x { name[32] (UTF-8, 0埋め), delayTime, roomSize, mix, volume (float) }
+// ファイルが無い/読めない時は組み込みのプリセットを使う
+// getPreset()の値は必ずパラメータの範囲内 (NaN/infや範囲外の値は直して返す)
+class PresetBank
+{
+public:
+    struct Preset
+    {
+        juce::String name;
+        float delayTime;
+        float roomSize;
+        float mix;
+        float volume;
+    };
+
+    PresetBank();
+
+    bool loadFromFile (const juce::File& file);
+    static juce::File getDefaultFile();
+
+    int size() const { return numPresets; }
+    juce::String getName (int index) const;
+    Preset getPreset (int index) const;
+
+private:
+    // ファイル上のエントリの並び, 直接キャストはせずByteOrderでlittle endianとして読む (アラインメントもendianも仮定しない)
+    struct Entry
+    {
+        char name[32];
+        float values[4];
+    };
+    static_assert (sizeof (Entry) == 48, "a preset entry is 48 bytes in the file");
+    const char* getEntry (int index) const;
+    float getEntryValue (int index, int value) const;
+
+    std::unique_ptr<juce::MemoryMappedFile> mappedFile;
+    const char* entries = nullptr;
+    int numPresets = 0;
+
+    JUCE_DECLARE_NON_COPYABLE (PresetBank)
+};
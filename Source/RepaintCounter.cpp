@@ -0,0 +1,11 @@
+/*
+  ==============================================================================
+
+    RepaintCounter.cpp
+
+  ==============================================================================
+*/
+
+#include "RepaintCounter.h"
+std::atomic<juce::int64> RepaintCounter::numPaints { 0 };
+std::atomic<juce::int64> RepaintCounter::numPixels { 0 };
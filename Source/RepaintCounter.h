@@ -0,0 +1,35 @@
+/*
+  ==============================================================================
+
+    RepaintCounter.h
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+
+// 全エディタ共通の再描画コスト計測, paintが呼ばれた回数と描画したピクセル数を数える
+class RepaintCounter
+{
+public:
+    static void addPaint (juce::Graphics& g)
+    {
+        auto clip = g.getClipBounds();
+        numPaints += 1;
+        numPixels += (juce::int64) clip.getWidth() * clip.getHeight();
+    }
+
+    static juce::int64 getNumPaints() { return numPaints.load(); }
+    static juce::int64 getNumPixels() { return numPixels.load(); }
+
+    static void reset()
+    {
+        numPaints = 0;
+        numPixels = 0;
+    }
+
+private:
+    static std::atomic<juce::int64> numPaints;
+    static std::atomic<juce::int64> numPixels;
+};
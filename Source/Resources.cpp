@@ -0,0 +1,256 @@
+/*
+  ==============================================================================
+
+    Resources.cpp
+
+  ==============================================================================
+*/
+
+#include "Resources.h"
+
+// "../Resource/bg.png"
+static const unsigned char resource_bg_png[] = { 137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,1,84,0,0,1,147,8,6,0,0,0,119,127,234,185,0,0,0,1,115,82,71,66,0,174,206,28,233,0,0,0,56,101,88,
+73,102,77,77,0,42,0,0,0,8,0,1,135,105,0,4,0,0,0,1,0,0,0,26,0,0,0,0,0,2,160,2,0,4,0,0,0,1,0,0,1,84,160,3,0,4,0,0,0,1,0,0,1,147,0,0,0,0,235,155,190,245,0,0,51,105,73,68,65,84,120,1,237,156,7,128,93,69,217,
+191,223,77,207,110,234,166,247,70,18,72,66,122,128,16,58,36,160,145,170,136,5,248,35,136,136,34,138,70,44,159,31,40,127,253,20,69,5,69,197,130,40,250,209,68,64,122,73,32,129,64,32,164,247,222,179,41,155,
+178,41,187,155,205,110,118,191,121,207,230,220,156,123,239,108,59,153,187,36,153,103,146,187,247,156,57,51,239,57,243,204,220,223,153,121,103,206,201,122,106,194,164,10,33,64,0,2,16,128,192,81,19,104,
+112,212,22,48,0,1,8,64,0,2,1,1,4,149,134,0,1,8,64,192,17,1,4,213,17,72,204,64,0,2,16,64,80,105,3,16,128,0,4,28,17,64,80,29,129,196,12,4,32,0,1,4,149,54,0,1,8,64,192,17,1,4,213,17,72,204,64,0,2,16,64,80,
+105,3,16,128,0,4,28,17,64,80,29,129,196,12,4,32,0,1,4,149,54,0,1,8,64,192,17,1,4,213,17,72,204,64,0,2,16,64,80,105,3,16,128,0,4,28,17,64,80,29,129,196,12,4,32,0,1,4,149,54,0,1,8,64,192,17,1,4,213,17,72,
+204,64,0,2,16,64,80,105,3,16,128,0,4,28,17,64,80,29,129,196,12,4,32,0,1,4,149,54,0,1,8,64,192,17,1,4,213,17,72,204,64,0,2,16,64,80,105,3,16,128,0,4,28,17,64,80,29,129,196,12,4,32,0,1,4,149,54,0,1,8,64,
+192,17,1,4,213,17,72,204,64,0,2,16,64,80,105,3,16,128,0,4,28,17,64,80,29,129,196,12,4,32,0,129,70,245,133,96,252,239,239,144,54,253,186,86,121,186,205,239,45,146,149,207,78,151,252,5,171,171,76,211,245,
+204,193,50,238,238,27,170,60,158,122,160,96,117,158,188,241,149,95,167,70,179,15,1,8,64,32,35,4,234,77,80,171,19,83,45,89,183,51,135,4,31,21,214,15,239,123,82,74,11,15,164,21,184,109,191,110,105,113,213,
+69,212,116,206,234,242,114,12,2,16,128,64,93,9,212,155,160,134,23,86,184,109,151,172,127,99,118,184,43,217,29,219,72,135,97,253,36,167,83,110,16,167,194,218,228,238,230,50,245,206,135,18,105,194,141,21,
+207,188,29,110,214,234,123,247,234,205,181,74,71,34,8,64,0,2,46,8,212,187,160,22,109,221,45,139,255,241,122,218,181,235,112,254,180,111,93,35,141,91,52,15,4,182,195,208,126,105,195,127,237,181,218,242,
+166,25,35,2,2,16,128,192,71,64,224,152,153,148,202,123,111,177,204,123,232,249,4,130,142,166,215,74,128,0,4,32,112,60,17,56,102,4,85,161,21,110,219,125,60,177,227,90,33,0,1,8,36,17,56,166,4,53,233,202,
+216,129,0,4,32,112,156,17,56,166,4,117,240,181,227,19,248,10,183,238,74,108,179,1,1,8,64,224,120,32,80,239,147,82,54,40,141,115,154,201,152,73,215,4,147,81,122,188,116,127,177,232,242,41,2,4,32,0,129,
+227,137,64,189,11,106,118,231,182,50,248,186,9,9,70,186,108,74,151,74,233,236,126,24,102,254,210,190,14,85,133,183,247,132,49,210,36,146,54,204,99,251,222,62,127,117,218,74,1,91,58,226,32,0,1,8,184,32,
+80,239,130,170,235,77,7,69,134,246,209,66,104,207,84,197,84,103,252,109,97,192,85,231,84,153,215,150,94,207,243,175,139,191,109,59,68,28,4,32,0,1,231,4,234,93,80,171,42,193,186,215,63,12,150,77,217,158,
+144,10,243,28,52,130,91,151,160,2,77,128,0,4,32,80,95,4,234,93,80,245,249,250,112,189,105,183,177,131,165,255,85,103,39,202,90,157,152,106,162,149,207,190,35,249,102,24,31,117,15,36,50,91,54,10,120,82,
+202,66,133,40,8,64,32,83,4,234,93,80,181,215,24,190,0,69,5,175,247,132,209,129,64,170,111,116,241,63,223,144,162,26,214,162,22,172,201,203,20,11,236,66,0,2,16,56,42,2,31,233,178,41,237,145,174,124,110,
+122,162,0,209,101,83,137,72,54,32,0,1,8,28,39,4,62,82,65,85,70,250,194,147,208,215,169,189,212,236,78,109,143,19,116,92,38,4,32,0,129,100,2,31,185,160,166,246,82,245,5,41,4,8,64,0,2,199,35,129,143,92,
+80,21,90,180,151,170,175,242,211,55,77,17,32,0,1,8,28,111,4,142,9,65,77,237,165,226,75,61,222,154,17,215,11,1,8,40,129,122,159,229,175,10,187,246,82,251,95,113,86,181,239,67,109,211,183,171,12,255,242,
+101,85,153,72,139,15,150,104,253,241,200,43,1,211,18,16,1,1,8,64,192,33,129,99,70,80,181,151,170,203,166,66,193,236,127,229,89,137,229,85,97,121,187,141,27,146,120,222,63,140,171,238,91,221,7,243,16,212,
+234,16,113,12,2,16,112,72,160,222,134,252,218,91,212,176,226,185,119,170,188,124,93,184,31,166,219,179,102,75,90,186,205,239,46,50,239,76,173,253,91,168,120,193,74,26,66,34,32,0,129,12,18,200,122,106,
+194,164,138,12,218,199,52,4,32,0,1,111,8,212,91,15,213,27,162,20,20,2,16,240,150,0,130,234,109,213,83,112,8,64,192,53,1,4,213,53,81,236,65,0,2,222,18,64,80,189,173,122,10,14,1,8,184,38,128,160,186,38,
+138,61,8,64,192,91,2,8,170,183,85,79,193,33,0,1,215,4,16,84,215,68,177,7,1,8,120,75,0,65,245,182,234,41,56,4,32,224,154,0,130,234,154,40,246,32,0,1,111,9,32,168,222,86,61,5,135,0,4,92,19,64,80,93,19,197,
+30,4,32,224,45,1,4,213,219,170,167,224,16,128,128,107,2,8,170,107,162,216,131,0,4,188,37,128,160,122,91,245,20,28,2,16,112,77,0,65,117,77,20,123,16,128,128,183,4,16,84,111,171,158,130,67,0,2,174,9,32,
+168,174,137,98,15,2,16,240,150,0,130,234,109,213,83,112,8,64,192,53,1,4,213,53,81,236,65,0,2,222,18,64,80,189,173,122,10,14,1,8,184,38,128,160,186,38,138,61,8,64,192,91,2,8,170,183,85,79,193,33,0,1,215,
+4,16,84,215,68,177,7,1,8,120,75,0,65,245,182,234,41,56,4,32,224,154,0,130,234,154,40,246,32,0,1,111,9,32,168,222,86,61,5,135,0,4,92,19,64,80,93,19,197,30,4,32,224,45,1,4,213,219,170,167,224,16,128,128,
+107,2,8,170,107,162,216,131,0,4,188,37,128,160,122,91,245,20,28,2,16,112,77,0,65,117,77,20,123,16,128,128,183,4,16,84,111,171,158,130,67,0,2,174,9,32,168,174,137,98,15,2,16,240,150,0,130,234,109,213,83,
+112,8,64,192,53,1,4,213,53,81,236,65,0,2,222,18,64,80,189,173,122,10,14,1,8,184,38,128,160,186,38,138,61,8,64,192,91,2,8,170,183,85,79,193,33,0,1,215,4,16,84,215,68,177,7,1,8,120,75,0,65,245,182,234,41,
+56,4,32,224,154,0,130,234,154,40,246,32,0,1,111,9,32,168,222,86,61,5,135,0,4,92,19,64,80,93,19,197,30,4,32,224,45,1,4,213,219,170,167,224,16,128,128,107,2,8,170,107,162,216,131,0,4,188,37,208,200,219,
+146,87,81,240,22,221,218,75,118,135,54,146,213,208,114,175,169,168,144,162,252,2,41,220,178,75,202,203,14,85,97,225,72,116,195,38,141,164,101,207,78,210,180,117,206,145,200,42,182,246,172,221,34,7,118,
+237,75,59,218,97,104,63,233,52,226,36,217,181,98,147,228,189,191,68,196,92,131,45,180,233,219,85,186,156,113,138,20,109,47,144,205,211,23,74,217,129,131,105,201,92,92,143,26,109,220,162,185,180,52,156,
+244,219,22,202,138,75,100,255,230,157,82,178,103,191,237,176,53,174,109,255,110,210,166,111,55,105,217,163,131,100,119,108,43,135,204,245,31,220,95,44,123,215,111,147,252,133,171,101,127,222,78,107,190,
+104,164,214,91,78,215,118,210,160,81,195,104,116,218,118,89,81,137,236,90,190,65,42,202,237,44,211,50,212,16,209,126,112,111,105,213,187,179,180,238,213,89,154,180,108,46,133,91,119,201,126,243,217,183,
+113,187,236,92,178,190,134,220,201,135,181,221,117,30,53,80,58,143,30,96,218,96,67,217,183,57,95,54,78,157,111,218,198,222,228,132,41,123,173,251,118,145,102,109,91,166,196,86,189,91,126,176,76,118,46,
+91,47,229,165,150,118,156,149,37,45,187,155,122,232,208,90,196,108,87,23,138,119,236,9,234,168,186,52,62,29,203,122,106,194,36,55,173,234,56,167,166,141,241,172,255,127,163,180,237,223,189,198,146,232,
+15,177,96,213,102,89,248,200,203,178,109,206,74,107,250,220,147,123,202,184,187,111,144,102,185,181,108,228,70,40,183,204,92,42,211,239,122,36,97,111,220,143,190,32,93,207,24,148,216,95,248,215,87,100,
+217,147,111,38,246,195,141,214,230,199,124,209,131,95,151,6,141,43,239,143,42,100,111,220,250,107,41,222,121,228,71,232,226,122,244,124,39,93,62,78,134,126,241,19,162,226,92,83,40,45,60,32,107,95,249,
+64,150,60,54,89,116,219,22,178,59,182,145,225,183,94,46,221,206,28,98,59,156,136,83,222,179,238,127,90,118,175,220,148,136,139,110,140,249,214,167,165,247,132,49,209,168,106,183,15,238,43,146,25,63,249,
+167,108,159,107,175,191,106,51,31,62,216,254,212,62,50,252,150,203,170,109,51,187,205,141,112,225,223,94,145,109,179,87,212,198,164,140,190,227,106,233,115,201,105,73,105,149,221,43,95,184,215,122,131,
+210,27,208,89,247,220,36,45,204,141,164,174,161,180,232,128,44,248,243,75,178,230,229,247,19,89,155,180,204,150,115,126,122,115,181,101,74,36,62,188,81,184,101,167,76,190,253,55,114,112,111,81,234,33,
+239,246,45,221,48,239,24,4,5,30,244,249,139,106,221,136,178,26,100,73,219,1,221,77,195,251,146,12,249,127,151,88,129,13,255,242,101,181,23,83,181,96,122,2,93,78,31,36,173,76,47,71,131,10,124,84,76,53,
+110,240,245,19,172,54,71,124,245,202,132,152,106,186,166,173,91,72,183,113,167,234,102,34,28,237,245,168,161,230,237,90,201,176,47,93,90,43,49,213,244,141,115,154,201,128,79,157,43,151,60,124,103,144,
+87,227,162,65,123,238,23,61,248,141,26,197,84,243,180,57,169,155,92,248,155,175,5,220,163,54,116,187,211,168,1,117,18,83,205,163,194,209,111,226,88,221,140,21,198,124,243,211,114,254,125,95,169,177,205,
+4,237,228,127,110,150,30,231,14,171,241,60,122,51,239,115,113,250,77,65,57,158,122,227,199,172,249,123,143,31,29,75,76,213,88,227,236,102,50,240,234,115,147,236,234,126,109,58,21,209,76,57,93,218,73,207,
+243,70,68,163,188,221,70,80,15,87,189,254,96,227,132,147,63,115,129,180,31,210,39,45,171,14,193,235,26,116,40,170,195,69,13,229,101,101,105,217,117,40,219,113,120,255,164,248,70,205,155,138,14,57,83,195,
+161,210,228,252,71,123,61,106,95,135,181,53,13,167,83,175,67,247,245,230,48,102,210,53,105,135,70,124,245,138,90,185,67,194,140,89,13,26,72,223,143,157,30,238,38,190,219,244,139,87,119,123,214,230,37,
+108,212,101,163,255,149,103,75,111,139,240,85,103,67,123,208,13,155,54,174,46,137,244,253,248,25,85,14,177,123,94,48,82,26,101,55,77,203,111,29,178,167,165,170,58,162,60,173,157,196,99,89,16,147,101,213,
+87,118,124,30,169,121,220,118,124,150,171,206,87,221,164,69,118,90,30,245,5,150,26,145,211,208,216,8,151,173,65,107,111,181,251,89,167,202,142,69,107,19,249,117,232,109,251,241,20,110,219,37,69,219,10,
+18,233,162,27,5,107,242,140,175,108,158,28,42,169,244,125,30,220,87,108,134,183,155,77,111,33,185,129,171,63,117,195,155,115,18,89,59,156,218,215,234,239,141,14,101,93,92,143,158,208,198,72,227,213,191,
+167,174,93,117,183,5,126,60,139,223,173,211,200,1,129,207,181,212,248,69,53,168,175,48,181,23,173,241,75,31,159,98,220,4,51,165,73,171,236,160,135,126,242,53,23,152,222,247,17,159,232,161,146,82,77,150,
+20,154,84,225,203,205,95,176,38,41,93,184,163,67,221,173,179,150,201,250,41,71,56,134,199,106,250,214,222,219,208,155,38,90,147,105,29,22,109,219,45,185,3,123,166,141,36,26,54,109,34,57,157,219,25,127,
+227,86,107,94,45,99,143,115,134,90,143,105,164,186,88,186,159,53,84,214,189,254,97,82,154,117,147,103,155,145,205,41,117,238,85,170,17,245,217,47,125,226,173,36,123,234,3,78,13,90,103,5,107,182,164,70,
+7,251,197,59,140,207,126,198,18,217,177,240,72,251,183,38,244,36,18,65,173,166,162,87,61,255,158,44,252,235,203,149,41,140,72,180,50,19,76,103,255,248,38,51,105,210,38,41,87,56,76,79,138,180,236,172,125,
+117,166,44,125,108,138,229,136,61,106,227,219,243,211,4,53,181,135,218,113,248,73,105,153,213,111,23,246,116,211,14,70,34,234,122,61,145,172,73,155,47,93,255,83,51,185,81,217,35,214,225,169,246,224,6,
+95,55,33,41,141,238,40,191,157,75,214,5,241,173,122,116,180,246,118,245,102,161,55,30,253,168,191,116,203,204,101,50,246,7,215,5,204,117,34,105,229,115,211,131,252,53,253,169,40,47,151,169,223,254,67,
+77,201,234,124,92,123,213,81,129,87,3,122,174,153,191,120,194,220,232,230,86,218,51,109,101,216,23,39,6,238,142,240,4,123,214,109,173,82,76,53,77,151,211,78,73,159,228,11,239,82,135,141,244,186,112,100,
+154,160,6,254,203,219,30,144,236,78,109,3,23,139,38,109,218,42,71,206,189,247,150,195,185,142,124,169,255,125,131,185,105,107,168,56,84,97,38,205,182,213,106,98,78,235,97,218,119,255,116,196,16,91,85,
+18,64,80,171,68,147,114,192,52,110,237,93,108,154,190,64,6,92,117,78,210,193,3,187,211,103,231,147,18,196,220,217,56,117,174,12,85,223,89,164,199,167,98,174,19,16,225,172,119,71,211,99,77,13,27,222,58,
+252,195,78,61,80,15,251,58,129,178,242,217,119,100,240,181,227,147,174,91,79,29,229,84,213,42,137,115,126,118,75,48,145,181,121,198,226,96,226,79,69,244,165,235,126,18,184,6,74,246,20,214,67,9,170,62,
+133,250,144,219,153,201,198,212,160,35,139,132,152,234,65,211,86,230,255,249,69,51,67,191,195,76,48,141,145,226,252,61,102,98,234,213,212,108,73,251,189,46,28,149,180,127,200,204,194,111,154,54,95,122,
+141,63,18,175,43,62,244,26,162,147,141,97,38,237,25,135,33,24,37,132,59,145,239,226,29,123,101,79,21,61,205,72,50,54,143,130,0,130,90,7,120,58,140,239,108,38,64,82,67,222,140,69,169,81,214,253,147,46,
+27,103,134,117,201,147,19,229,101,229,193,178,160,53,47,127,16,44,179,137,102,212,37,80,59,151,174,151,118,131,122,71,163,3,63,170,10,170,14,139,219,244,233,146,116,76,87,32,108,156,86,217,11,73,58,96,
+217,169,235,245,88,76,88,163,186,142,29,156,38,166,186,44,44,218,107,222,159,183,67,212,173,145,58,196,84,193,24,100,196,88,63,42,160,234,186,216,96,202,179,213,244,84,235,18,212,223,58,225,161,111,166,
+101,81,166,121,239,47,54,51,219,31,164,29,171,41,34,247,148,94,105,229,210,60,107,95,75,30,134,135,118,116,246,60,58,131,30,198,167,126,235,242,51,237,161,70,195,246,121,43,69,71,40,81,65,85,247,82,207,
+11,70,200,242,127,77,139,38,205,248,182,150,219,198,178,96,85,158,172,55,35,138,109,115,106,183,130,33,227,23,122,12,156,0,65,173,166,18,122,158,63,66,114,79,238,17,164,104,156,221,220,172,147,236,146,
+230,175,92,103,126,76,155,222,89,88,141,149,35,135,180,231,96,235,61,168,159,180,173,153,88,153,122,231,67,71,18,31,222,218,240,214,188,52,65,85,63,170,254,80,131,225,127,164,247,170,89,212,151,107,235,
+193,164,25,54,17,113,174,199,102,231,28,51,139,93,81,81,46,89,230,95,75,51,148,79,93,42,166,203,184,62,252,229,83,73,107,104,85,248,23,253,253,21,25,121,219,85,54,147,65,156,174,2,232,113,222,240,224,
+163,54,230,254,238,63,181,190,89,168,129,214,41,55,155,48,78,125,142,251,54,230,155,27,153,221,199,26,156,220,242,199,86,119,154,76,215,37,71,131,174,32,208,155,138,78,24,134,65,175,95,151,78,233,114,
+173,212,160,190,211,84,55,130,46,161,83,81,85,159,113,212,31,223,235,130,81,245,46,168,141,154,53,169,146,101,183,179,134,200,11,159,185,199,186,238,57,181,156,62,236,35,168,213,212,178,14,175,83,253,
+165,97,114,245,43,45,249,231,27,149,139,237,195,200,163,248,214,5,233,182,160,189,148,225,183,94,38,218,227,10,67,135,97,149,195,252,78,22,255,169,171,225,126,85,215,19,94,67,244,187,195,208,190,209,221,
+196,182,206,64,175,120,102,154,241,123,190,107,93,152,190,250,133,25,70,44,154,152,73,158,143,39,149,47,97,32,178,161,75,193,206,248,254,231,205,196,78,91,179,22,55,121,34,37,146,172,214,155,45,186,182,
+175,179,160,170,127,216,22,14,20,28,121,128,65,203,51,241,31,223,79,18,211,48,79,137,73,247,202,77,63,151,112,98,46,140,87,145,76,13,91,222,95,42,58,236,87,81,213,229,116,97,208,5,252,234,179,175,106,
+114,43,76,87,95,223,122,211,104,106,58,10,101,102,45,42,65,228,200,175,20,26,117,34,16,204,246,222,252,137,96,161,123,157,50,90,18,235,130,232,170,38,171,244,71,184,125,222,170,164,92,218,115,211,31,86,
+170,255,180,226,80,185,233,45,47,72,74,27,103,167,186,235,169,139,61,237,117,245,191,226,108,25,253,141,79,74,115,125,234,198,18,86,60,61,45,88,180,190,252,169,183,2,95,163,37,73,82,212,224,235,47,22,
+125,154,45,118,48,254,205,93,203,54,4,195,233,186,218,168,106,225,122,147,22,71,132,86,71,27,209,158,105,244,28,77,219,180,72,115,249,232,13,187,253,144,222,209,100,162,238,17,125,34,79,67,158,17,214,
+212,160,147,83,199,66,208,137,72,157,216,212,137,49,66,37,1,122,168,213,180,4,245,241,29,220,87,104,230,132,178,204,44,106,174,233,69,37,63,134,167,143,231,141,248,202,21,193,204,181,46,113,170,41,172,
+121,201,248,212,94,77,246,221,233,228,204,94,51,3,92,221,99,144,58,236,215,101,71,209,208,199,60,21,164,189,172,104,216,58,123,185,117,72,25,77,19,221,142,123,61,81,27,186,93,57,65,86,17,44,150,215,225,
+110,52,232,112,85,123,88,218,7,139,62,5,22,77,163,190,213,5,15,191,28,124,244,169,175,206,198,159,216,213,124,2,161,73,113,105,232,58,88,93,42,182,223,76,248,84,23,148,231,148,175,255,38,45,137,78,16,
+69,39,199,210,18,84,19,113,160,96,159,245,104,78,231,220,132,155,69,31,53,45,88,157,39,109,250,217,215,33,107,111,62,234,87,213,245,165,209,73,71,61,193,150,15,142,136,168,14,253,83,131,250,81,19,171,
+79,82,15,102,96,127,215,242,141,50,231,193,103,146,45,87,136,236,221,176,61,177,204,47,249,160,191,123,8,106,53,117,175,13,63,108,184,218,235,56,245,11,31,179,246,72,59,153,103,175,107,35,168,69,102,205,
+158,46,105,170,107,216,252,238,66,25,117,251,85,73,79,67,245,251,196,153,105,102,84,120,235,18,226,94,79,234,57,94,251,210,125,137,101,83,234,183,60,255,87,95,9,158,194,137,166,235,56,194,60,155,110,110,
+72,209,27,135,222,36,78,249,220,133,146,99,158,221,215,229,80,43,158,121,91,116,121,145,126,180,199,170,182,46,250,237,237,73,229,86,155,181,123,204,178,34,22,235,232,53,167,110,239,92,188,190,210,15,
+156,34,242,58,67,191,99,241,186,32,185,46,161,122,227,43,191,14,122,209,195,111,185,52,105,184,174,9,82,111,202,169,179,251,154,166,187,241,169,70,151,195,169,205,168,203,71,223,89,160,51,254,249,11,86,
+107,242,140,135,50,179,110,55,78,187,205,248,133,29,131,39,96,200,95,203,74,209,69,254,250,76,182,237,153,116,125,81,72,109,66,3,243,178,11,93,100,111,251,84,151,95,207,185,245,195,229,73,73,82,39,49,
+116,242,34,207,44,53,170,75,136,123,61,213,157,67,135,171,43,254,253,118,90,18,93,152,222,188,125,242,176,95,111,18,218,219,212,53,148,195,140,248,232,115,236,209,114,105,79,210,182,188,74,5,183,230,144,
+101,229,172,236,173,47,190,169,217,96,240,44,189,174,186,72,13,125,62,118,154,232,138,137,80,44,181,172,186,188,42,117,230,62,53,159,222,48,90,245,236,152,26,29,140,60,244,221,11,225,39,42,166,97,226,
+158,102,178,174,190,130,158,223,214,102,3,150,41,163,182,250,186,166,99,245,60,244,80,235,80,51,250,104,232,190,77,219,131,39,97,162,217,154,183,111,19,221,77,154,205,142,30,8,151,3,69,227,194,109,157,
+5,214,161,222,156,223,62,19,76,70,132,241,225,247,6,179,38,181,235,153,102,57,82,21,65,135,134,42,250,214,160,11,196,45,225,104,174,199,98,46,17,165,107,71,109,65,57,233,178,37,13,234,79,212,103,192,163,
+65,95,10,162,189,86,93,42,165,111,203,210,109,155,63,50,236,13,38,242,90,202,167,226,246,201,23,127,154,72,18,221,208,94,178,250,81,117,161,123,240,6,175,232,193,26,182,231,252,246,89,243,78,1,237,53,
+31,121,122,75,5,71,23,252,15,53,139,249,117,57,152,186,130,84,108,106,10,250,132,93,220,160,179,235,179,127,243,239,184,217,171,204,23,29,65,132,137,58,12,235,87,37,75,189,145,111,51,245,181,224,47,47,
+165,45,251,11,243,251,244,77,15,245,112,109,235,227,136,169,193,22,23,10,66,52,109,243,118,45,163,187,65,175,74,253,175,117,9,58,139,173,111,75,234,158,178,78,53,180,161,63,124,219,43,249,194,227,213,
+205,238,107,47,207,197,245,216,120,232,15,170,226,80,242,43,224,108,140,244,58,163,156,116,178,45,77,24,77,26,157,164,209,231,228,245,173,86,250,38,165,212,160,175,38,140,46,98,215,227,197,150,215,30,
+166,230,139,238,171,216,182,27,212,203,244,138,47,139,70,215,106,91,31,47,213,183,140,217,130,250,139,181,215,89,27,49,213,252,218,3,77,13,186,148,75,151,225,165,126,244,102,30,13,218,94,82,111,72,225,
+113,125,92,218,246,140,127,201,222,154,31,140,168,171,127,89,203,172,47,241,57,249,234,243,194,211,123,253,141,160,30,174,254,45,31,44,73,107,8,209,201,129,240,160,46,100,78,13,250,24,95,106,136,187,216,
+89,103,234,109,65,133,107,189,121,110,219,22,116,221,169,237,90,163,105,93,92,79,254,252,85,105,162,190,117,214,242,36,191,168,158,83,223,97,170,175,219,75,13,169,156,222,187,231,239,53,78,46,69,109,232,
+99,171,239,255,236,177,104,84,176,173,171,32,108,61,171,180,132,41,17,234,155,140,19,212,165,161,19,122,181,57,231,38,179,236,45,26,162,239,188,13,93,4,225,113,173,251,119,127,248,55,153,241,227,71,211,
+62,250,228,88,106,72,113,229,38,14,235,251,32,182,205,73,118,17,233,140,188,109,130,43,145,233,240,70,220,118,82,94,69,187,77,181,127,162,239,55,188,186,223,153,63,60,209,11,89,155,242,21,153,23,229,118,
+48,111,141,106,150,219,202,244,184,204,242,35,243,67,88,253,194,123,105,89,117,65,184,46,194,111,209,173,67,48,251,175,61,191,249,127,122,62,109,184,163,61,13,237,109,53,107,219,66,116,97,116,77,65,95,
+212,187,97,202,92,89,241,236,219,85,254,80,119,175,218,36,93,198,156,28,12,151,67,123,218,107,253,240,190,39,211,206,31,30,15,191,93,92,143,114,209,89,246,92,243,234,66,237,133,233,243,246,139,204,35,
+149,209,39,160,194,243,233,139,145,187,154,217,253,112,81,186,10,239,210,199,39,7,108,195,52,250,18,105,125,98,169,216,44,17,106,105,120,86,245,34,110,29,70,235,187,96,231,253,241,133,196,228,87,104,67,
+191,213,93,178,127,203,142,224,93,1,250,74,186,154,124,164,90,14,125,105,245,226,71,95,75,60,194,27,181,87,155,109,189,129,233,100,161,206,240,219,150,113,105,125,46,254,199,235,230,17,212,151,164,163,
+241,19,107,58,13,26,23,46,51,218,183,105,135,113,107,244,55,47,157,105,30,28,155,255,231,23,36,127,190,125,162,73,215,61,235,131,38,234,2,209,245,169,43,255,61,205,44,253,90,16,228,179,253,209,167,204,
+186,25,151,66,248,118,176,149,255,153,46,91,244,5,229,53,4,125,250,73,221,25,250,146,111,61,151,174,112,169,46,104,207,89,125,247,250,206,91,219,67,11,213,229,61,17,143,241,130,233,148,90,213,69,211,37,
+102,121,76,77,207,141,235,35,147,45,123,116,170,124,243,123,61,223,157,245,73,164,86,230,220,197,187,246,4,61,188,218,244,148,82,138,121,84,187,186,120,189,85,175,142,53,207,252,154,31,163,46,31,58,104,
+134,154,85,185,1,162,23,162,11,231,245,135,172,159,166,230,177,90,189,201,169,88,7,130,109,241,147,70,243,126,148,219,42,60,42,170,122,83,80,63,182,222,248,146,122,162,135,223,194,175,109,202,230,95,206,
+29,216,35,72,31,174,61,173,170,44,122,115,106,107,94,51,185,103,237,86,243,22,180,116,23,85,106,190,224,209,100,243,26,73,21,247,125,155,242,83,15,179,159,1,2,8,106,6,160,98,18,2,16,240,147,0,62,84,63,
+235,157,82,67,0,2,25,32,128,160,102,0,42,38,33,0,1,63,9,32,168,126,214,59,165,134,0,4,50,64,0,65,205,0,84,76,66,0,2,126,18,64,80,253,172,119,74,13,1,8,100,128,0,130,154,1,168,152,132,0,4,252,36,128,160,
+250,89,239,148,26,2,16,200,0,1,4,53,3,80,49,9,1,8,248,73,0,65,245,179,222,41,53,4,32,144,1,2,8,106,6,160,98,18,2,16,240,147,0,130,234,103,189,83,106,8,64,32,3,4,16,212,12,64,197,36,4,32,224,39,1,4,213,
+207,122,167,212,16,128,64,6,8,32,168,25,128,138,73,8,64,192,79,2,8,170,159,245,78,169,33,0,129,12,16,64,80,51,0,21,147,16,128,128,159,4,16,84,63,235,157,82,67,0,2,25,32,128,160,102,0,42,38,33,0,1,63,9,
+32,168,126,214,59,165,134,0,4,50,64,0,65,205,0,84,76,66,0,2,126,18,64,80,253,172,119,74,13,1,8,100,128,0,130,154,1,168,152,132,0,4,252,36,128,160,250,89,239,148,26,2,16,200,0,1,4,53,3,80,49,9,1,8,248,
+73,0,65,245,179,222,41,53,4,32,144,1,2,8,106,6,160,98,18,2,16,240,147,0,130,234,103,189,83,106,8,64,32,3,4,16,212,12,64,197,36,4,32,224,39,1,4,213,207,122,167,212,16,128,64,6,8,32,168,25,128,138,73,8,
+64,192,79,2,8,170,159,245,78,169,33,0,129,12,16,64,80,51,0,21,147,16,128,128,159,4,16,84,63,235,157,82,67,0,2,25,32,128,160,102,0,42,38,33,0,1,63,9,32,168,126,214,59,165,134,0,4,50,64,0,65,205,0,84,76,
+66,0,2,126,18,64,80,253,172,119,74,13,1,8,100,128,0,130,154,1,168,152,132,0,4,252,36,128,160,250,89,239,148,26,2,16,200,0,1,4,53,3,80,49,9,1,8,248,73,0,65,245,179,222,41,53,4,32,144,1,2,8,106,6,160,98,
+18,2,16,240,147,0,130,234,103,189,83,106,8,64,32,3,4,16,212,12,64,197,36,4,82,9,52,109,211,66,90,247,237,34,13,155,52,74,61,148,182,95,151,180,105,153,235,24,209,160,113,67,105,213,171,147,100,53,200,
+170,99,78,146,219,8,212,92,187,182,92,199,81,92,203,30,29,228,146,191,220,153,184,226,67,37,165,82,180,125,183,236,92,186,94,150,60,54,69,10,183,236,76,28,187,244,241,187,164,89,110,203,196,126,184,81,
+81,94,33,79,127,172,210,134,166,89,242,216,100,89,253,194,123,225,97,235,119,139,174,237,228,146,135,191,35,219,230,172,144,119,254,235,47,137,52,250,131,26,255,251,59,100,223,230,29,242,238,221,143,36,
+226,117,163,121,251,214,114,241,31,191,37,75,30,159,34,43,158,158,150,116,236,228,107,206,151,83,111,252,120,82,92,116,103,169,201,179,232,111,175,154,115,222,41,235,94,159,37,203,158,124,51,56,60,241,
+209,239,75,243,14,109,228,149,27,126,38,133,219,118,69,179,72,86,195,6,114,233,99,255,45,250,3,254,207,167,238,146,131,251,138,37,149,87,52,195,246,121,171,100,218,119,254,24,141,242,114,59,181,157,104,
+251,40,88,181,89,182,124,184,76,86,60,243,182,148,238,47,78,112,233,61,126,116,80,111,202,184,172,232,128,52,202,110,22,180,189,217,247,255,75,246,110,216,158,72,167,27,181,77,91,215,58,77,58,201,225,
+157,118,131,122,203,144,27,46,150,118,39,247,148,242,210,67,34,89,89,146,63,127,181,44,248,235,75,178,111,99,126,144,170,199,121,195,229,180,73,159,145,127,127,226,187,193,254,217,63,190,73,58,143,57,
+217,102,78,86,191,56,67,230,252,246,25,233,59,241,12,25,117,251,39,173,105,22,63,250,154,44,249,223,201,214,99,39,74,228,9,47,168,97,69,77,253,246,67,166,161,108,151,172,70,13,164,121,187,214,210,235,
+194,145,129,120,189,241,213,251,131,248,32,157,185,73,47,124,228,21,89,247,218,135,97,182,244,111,147,38,203,52,190,154,66,159,139,79,147,109,179,87,72,199,225,39,73,118,199,54,70,196,11,130,44,135,14,
+150,201,7,63,127,92,46,188,255,107,210,251,226,49,73,231,26,253,141,171,101,207,250,109,178,226,223,111,167,153,95,249,220,187,129,80,234,129,156,206,185,114,193,253,183,201,180,239,254,73,246,174,219,
+26,164,45,43,46,9,190,131,107,139,94,158,185,214,210,194,98,233,61,97,180,44,254,199,235,65,154,240,79,151,211,79,9,68,53,220,143,126,135,188,162,113,229,101,101,209,93,127,183,83,218,137,246,238,90,245,
+234,108,132,228,42,105,217,173,189,188,255,211,255,13,216,12,252,244,249,114,202,103,46,144,57,15,62,35,155,223,93,36,122,51,111,214,182,165,12,190,254,98,185,232,193,111,200,235,95,254,165,236,207,171,
+188,161,215,37,173,138,95,156,58,13,43,76,123,165,103,255,228,38,115,211,125,75,166,255,247,95,131,235,106,222,161,181,140,249,230,167,229,172,31,221,40,175,220,120,111,144,52,181,45,189,255,179,199,164,
+97,227,100,201,232,58,118,176,140,252,218,85,65,249,66,251,7,247,21,201,107,55,223,23,238,38,190,195,54,154,136,56,1,55,188,25,242,151,236,41,148,3,187,247,73,113,254,30,217,181,108,131,204,253,221,115,
+178,229,131,37,50,226,214,203,147,170,181,172,168,36,72,167,105,163,159,164,68,53,236,100,53,104,16,8,216,210,39,166,4,61,84,21,215,104,216,189,98,147,104,143,114,196,151,47,151,236,78,109,131,67,154,
+166,253,169,125,228,195,251,158,16,169,168,136,38,15,182,15,149,28,60,114,61,5,251,131,184,131,135,203,164,215,89,118,224,96,90,158,48,98,227,212,121,65,239,39,220,15,191,251,76,24,35,122,204,22,66,94,
+81,6,218,131,37,84,18,136,182,147,226,157,123,131,122,206,123,127,137,52,110,209,60,72,208,180,117,142,12,250,252,69,50,239,161,231,101,195,155,115,3,209,210,3,202,115,246,3,79,7,189,212,161,55,77,172,
+115,218,32,131,249,19,167,78,195,188,141,77,47,89,63,58,58,83,145,215,160,191,139,15,238,125,60,24,125,169,224,218,130,246,188,163,237,161,113,78,51,25,122,243,68,51,50,122,37,40,127,34,143,105,190,209,
+116,225,118,117,109,52,145,247,56,223,240,70,80,109,245,148,55,115,169,180,29,208,35,233,80,147,86,217,146,211,41,55,233,163,113,117,9,93,78,59,57,16,184,29,139,214,202,186,55,62,12,122,162,218,171,136,
+6,117,27,236,219,156,47,167,125,235,154,160,7,59,236,203,151,202,130,191,188,148,232,177,68,211,30,237,246,46,35,224,135,14,150,74,199,97,39,37,76,233,16,84,123,207,27,223,94,144,136,139,110,100,155,30,
+75,42,135,70,205,154,68,147,176,29,33,160,61,188,46,167,15,146,109,115,87,6,177,185,3,123,26,127,105,99,35,166,115,34,169,142,108,174,155,60,75,58,28,174,143,186,164,13,45,196,169,211,48,175,222,44,117,
+244,52,198,12,231,71,124,245,10,115,221,167,72,195,166,77,164,196,220,168,215,79,158,93,233,2,8,19,87,241,221,40,187,169,140,251,225,13,129,29,237,233,38,5,211,214,83,219,142,238,251,224,167,77,238,191,
+39,81,57,241,119,74,10,10,165,73,203,230,166,49,53,78,220,169,7,95,55,65,244,19,13,107,95,155,41,179,126,245,175,104,84,181,219,125,62,118,186,172,61,236,54,208,94,203,168,175,127,74,58,143,26,32,91,103,
+45,79,228,171,56,84,46,51,205,208,255,162,223,221,33,23,62,112,187,233,53,111,172,209,47,155,200,28,99,99,221,27,179,131,94,243,246,249,171,130,220,234,242,208,235,57,184,191,200,106,237,236,159,124,49,
+45,94,175,119,253,20,187,64,164,37,62,193,35,6,94,125,94,162,215,31,220,132,141,27,102,217,19,111,38,124,223,57,93,114,131,94,90,121,153,241,79,90,130,186,128,180,237,105,143,182,46,105,163,254,217,186,
+214,105,244,50,222,253,209,223,77,123,24,37,58,50,58,233,178,113,198,191,91,98,110,254,179,100,229,115,211,205,77,125,71,52,169,117,251,244,111,127,86,42,202,203,205,136,234,201,180,227,90,174,143,63,
+250,189,180,248,23,175,253,113,208,19,78,59,112,2,69,120,45,168,57,102,184,93,106,38,10,194,97,143,214,235,194,191,190,98,196,112,102,82,21,107,239,174,182,161,89,110,43,209,30,234,158,181,91,164,223,
+165,99,131,108,133,91,119,75,159,75,78,79,18,84,61,160,147,18,203,140,91,96,208,181,19,228,195,95,165,55,204,218,158,179,54,233,180,167,116,241,159,39,73,163,7,155,138,250,178,250,24,255,173,150,181,170,
+48,117,210,31,100,175,241,57,71,67,105,225,129,232,174,215,219,187,150,111,144,252,133,107,2,6,13,140,95,177,215,5,35,165,219,184,33,178,250,165,25,129,191,60,184,89,31,30,254,219,64,53,105,153,29,244,
+4,149,105,93,210,70,109,213,181,78,163,121,213,133,180,250,133,25,193,39,167,75,59,233,106,122,169,125,39,142,149,158,166,28,111,124,229,87,9,159,127,52,79,184,173,174,140,14,67,251,202,228,175,61,96,
+117,53,169,15,245,213,47,254,34,76,158,248,214,158,241,137,30,188,22,84,93,46,82,100,196,46,26,84,108,116,232,19,55,232,228,79,233,254,3,210,37,50,27,154,213,168,161,116,29,59,72,154,182,110,33,37,123,
+146,109,239,55,126,172,138,67,135,50,126,231,46,202,47,16,245,221,246,56,119,152,20,172,201,51,51,251,45,131,89,105,101,96,11,37,123,139,142,138,131,205,230,137,20,151,191,96,141,172,122,254,221,68,145,
+116,34,241,178,39,239,146,238,231,12,11,122,169,251,54,109,15,70,62,58,89,181,119,125,229,196,97,34,177,217,200,53,174,166,160,39,104,252,229,117,73,27,181,81,215,58,13,243,170,139,161,237,128,110,129,
+152,106,156,250,82,181,103,186,246,213,153,162,43,24,186,142,29,34,171,254,51,61,76,158,244,173,110,141,65,215,142,151,233,119,61,82,181,123,202,248,80,143,230,55,148,116,194,227,108,199,91,31,170,206,
+188,107,175,98,173,241,113,186,12,125,47,57,205,172,20,120,89,116,245,64,248,121,253,150,95,6,195,191,94,227,71,185,60,85,157,109,173,51,254,177,222,102,34,170,207,132,211,130,73,13,117,59,16,28,17,48,
+194,152,191,96,173,180,238,221,57,48,88,176,58,79,118,45,223,40,3,63,121,78,218,9,116,66,168,143,105,39,107,94,126,191,206,105,83,141,197,169,211,38,173,154,203,176,47,93,38,169,62,113,157,52,210,27,126,
+85,147,82,45,187,119,144,211,191,243,217,96,181,200,86,179,68,140,144,78,192,155,30,106,243,118,173,204,240,164,68,26,152,222,98,219,254,221,101,176,25,102,23,237,216,35,107,94,170,108,212,33,26,245,255,
+132,51,239,97,156,126,23,109,59,210,147,181,165,81,183,65,107,211,27,209,53,159,155,222,73,159,232,217,52,109,190,244,53,195,254,212,245,165,209,115,100,122,123,211,244,5,50,242,182,43,164,77,191,174,
+50,237,206,135,170,61,93,200,43,154,168,188,180,76,14,236,218,23,141,98,59,66,64,123,101,57,157,43,87,109,104,180,78,50,170,47,250,128,137,215,30,172,138,85,235,62,93,100,204,183,62,29,220,96,87,71,218,
+94,93,210,70,78,41,117,169,211,48,223,142,133,107,165,216,180,253,177,63,184,62,88,175,188,99,241,90,209,25,251,94,23,141,54,107,161,219,136,77,44,85,124,207,188,251,6,217,99,150,233,109,152,50,55,237,
+55,82,110,150,3,234,108,126,16,204,164,148,237,55,164,238,141,168,15,56,188,158,19,233,219,27,65,61,231,167,55,7,245,166,119,225,189,102,173,231,230,247,22,5,119,90,21,137,104,208,53,130,250,73,13,207,
+92,250,61,51,83,94,153,214,150,70,27,225,65,179,172,100,219,108,51,209,99,89,94,180,97,218,60,25,240,169,115,165,253,224,222,178,99,241,186,84,243,245,178,175,19,15,121,51,150,24,65,237,22,244,158,170,
+59,105,200,43,154,70,253,134,83,110,255,109,52,138,237,8,1,29,186,235,68,143,138,143,182,179,252,5,171,101,234,164,223,203,232,59,174,22,157,196,58,100,226,244,97,138,188,25,139,101,214,253,79,27,31,234,
+145,182,87,151,180,145,83,6,147,73,181,173,211,48,159,94,219,244,187,254,106,214,143,94,41,231,221,119,107,224,83,215,107,86,247,211,123,247,252,61,248,125,132,105,195,239,22,102,125,109,171,158,29,131,
+93,219,132,147,138,244,91,166,172,26,180,195,161,15,31,164,134,229,79,189,37,11,30,126,57,53,250,132,218,207,122,106,194,164,244,69,143,39,84,17,41,12,4,62,122,2,218,3,204,54,163,23,157,136,212,217,241,
+234,66,93,210,86,103,167,54,199,116,189,172,186,191,180,19,80,184,53,249,73,186,218,228,39,77,50,1,111,122,168,201,197,102,15,2,245,75,64,135,187,123,10,211,39,167,108,87,81,151,180,182,252,117,137,211,
+153,119,31,102,223,235,194,228,104,210,122,59,41,117,52,208,200,11,1,8,64,192,70,0,65,181,81,33,14,2,16,128,64,12,2,8,106,12,104,100,129,0,4,32,96,35,128,160,218,168,16,7,1,8,64,32,6,1,4,53,6,52,178,64,
+0,2,16,176,17,64,80,109,84,136,131,0,4,32,16,131,0,130,26,3,26,89,32,0,1,8,216,8,32,168,54,42,196,65,0,2,16,136,65,0,65,141,1,141,44,16,128,0,4,108,4,16,84,27,21,226,32,0,1,8,196,32,128,160,198,128,70,
+22,8,64,0,2,54,2,8,170,141,10,113,16,128,0,4,98,16,64,80,99,64,35,11,4,32,0,1,27,1,4,213,70,133,56,8,64,0,2,49,8,32,168,49,160,145,5,2,16,128,128,141,0,130,106,163,66,28,4,32,0,129,24,4,16,212,24,208,
+200,2,1,8,64,192,70,0,65,181,81,33,14,2,16,128,64,12,2,8,106,12,104,100,129,0,4,32,96,35,128,160,218,168,16,7,1,8,64,32,6,1,4,53,6,52,178,64,0,2,16,176,17,64,80,109,84,136,131,0,4,32,16,131,0,130,26,3,
+26,89,32,0,1,8,216,8,32,168,54,42,196,65,0,2,16,136,65,0,65,141,1,141,44,16,128,0,4,108,4,16,84,27,21,226,32,0,1,8,196,32,128,160,198,128,70,22,8,64,0,2,54,2,8,170,141,10,113,16,128,0,4,98,16,64,80,99,
+64,35,11,4,32,0,1,27,1,4,213,70,133,56,8,64,0,2,49,8,32,168,49,160,145,5,2,16,128,128,141,0,130,106,163,66,28,4,32,0,129,24,4,16,212,24,208,200,2,1,8,64,192,70,0,65,181,81,33,14,2,16,128,64,12,2,8,106,
+12,104,100,129,0,4,32,96,35,128,160,218,168,16,7,1,8,64,32,6,1,4,53,6,52,178,64,0,2,16,176,17,64,80,109,84,136,131,0,4,32,16,131,0,130,26,3,26,89,32,0,1,8,216,8,32,168,54,42,196,65,0,2,16,136,65,0,65,
+141,1,141,44,16,128,0,4,108,4,16,84,27,21,226,32,0,1,8,196,32,128,160,198,128,70,22,8,64,0,2,54,2,8,170,141,10,113,16,128,0,4,98,16,64,80,99,64,35,11,4,32,0,1,27,1,4,213,70,133,56,8,64,0,2,49,8,32,168,
+49,160,145,5,2,16,128,128,141,0,130,106,163,66,28,4,32,0,129,24,4,16,212,24,208,200,2,1,8,64,192,70,0,65,181,81,33,14,2,16,128,64,12,2,8,106,12,104,100,129,0,4,32,96,35,128,160,218,168,16,7,1,8,64,32,
+6,1,4,53,6,52,178,64,0,2,16,176,17,64,80,109,84,136,131,0,4,32,16,131,0,130,26,3,26,89,32,0,1,8,216,8,32,168,54,42,196,65,0,2,16,136,65,0,65,141,1,141,44,16,128,0,4,108,4,16,84,27,21,226,32,0,1,8,196,
+32,128,160,198,128,70,22,8,64,0,2,54,2,8,170,141,10,113,16,128,0,4,98,16,64,80,99,64,35,11,4,32,0,1,27,1,4,213,70,133,56,8,64,0,2,49,8,32,168,49,160,145,5,2,16,128,128,141,0,130,106,163,66,28,4,32,0,129,
+24,4,16,212,24,208,200,2,1,8,64,192,70,0,65,181,81,33,14,2,16,128,64,12,2,8,106,12,104,100,129,0,4,32,96,35,128,160,218,168,16,7,1,8,64,32,6,1,4,53,6,52,178,64,0,2,16,176,17,64,80,109,84,136,131,0,4,32,
+16,131,0,130,26,3,26,89,32,0,1,8,216,8,32,168,54,42,196,65,0,2,16,136,65,0,65,141,1,141,44,16,128,0,4,108,4,16,84,27,21,226,32,0,1,8,196,32,128,160,198,128,70,22,8,64,0,2,54,2,8,170,141,10,113,16,128,
+0,4,98,16,64,80,99,64,35,11,4,32,0,1,27,1,4,213,70,133,56,8,64,0,2,49,8,32,168,49,160,145,5,2,16,128,128,141,0,130,106,163,66,28,4,32,0,129,24,4,16,212,24,208,200,2,1,8,64,192,70,0,65,181,81,33,14,2,16,
+128,64,12,2,8,106,12,104,100,129,0,4,32,96,35,128,160,218,168,16,7,1,8,64,32,6,1,4,53,6,52,178,64,0,2,16,176,17,64,80,109,84,136,131,0,4,32,16,131,0,130,26,3,26,89,32,0,1,8,216,8,32,168,54,42,196,65,0,
+2,16,136,65,0,65,141,1,141,44,16,128,0,4,108,4,16,84,27,21,226,32,0,1,8,196,32,128,160,198,128,70,22,8,64,0,2,54,2,8,170,141,10,113,16,128,0,4,98,16,64,80,99,64,35,11,4,32,0,1,27,1,4,213,70,133,56,8,64,
+0,2,49,8,32,168,49,160,145,5,2,16,128,128,141,0,130,106,163,66,28,4,32,0,129,24,4,16,212,24,208,200,2,1,8,64,192,70,0,65,181,81,33,14,2,16,128,64,12,2,8,106,12,104,100,129,0,4,32,96,35,128,160,218,168,
+16,7,1,8,64,32,6,1,4,53,6,52,178,64,0,2,16,176,17,64,80,109,84,136,131,0,4,32,16,131,0,130,26,3,26,89,32,0,1,8,216,8,32,168,54,42,196,65,0,2,16,136,65,0,65,141,1,141,44,16,128,0,4,108,4,16,84,27,21,226,
+32,0,1,8,196,32,128,160,198,128,70,22,8,64,0,2,54,2,8,170,141,10,113,16,128,0,4,98,16,64,80,99,64,35,11,4,32,0,1,27,1,4,213,70,133,56,8,124,4,4,154,182,105,33,173,251,118,145,134,77,26,125,4,103,231,148,
+46,8,52,188,186,223,153,63,116,97,8,27,201,4,122,143,31,45,227,255,112,135,228,116,206,149,188,247,22,39,31,52,123,253,175,56,75,46,124,224,107,210,180,85,182,108,253,112,121,112,252,146,135,239,148,70,
+205,155,202,142,197,107,101,192,39,207,145,115,239,189,69,54,155,188,37,123,246,39,242,15,190,110,130,156,241,189,207,201,250,201,115,228,80,201,193,68,60,27,199,22,129,139,255,52,73,90,247,238,44,91,
+102,46,77,186,176,6,141,27,202,229,79,223,35,7,247,21,203,238,149,155,130,99,218,86,206,254,201,23,101,208,181,227,165,215,249,35,100,240,245,23,75,167,81,3,100,215,210,245,166,238,11,19,249,47,125,252,
+46,57,116,176,84,118,175,216,152,136,139,110,156,253,227,155,164,227,240,147,36,111,198,146,104,180,72,86,150,92,253,218,47,100,207,218,45,178,111,227,118,201,233,148,43,87,60,115,143,232,121,87,62,55,
+61,57,173,217,83,81,191,204,156,171,251,89,167,202,234,23,103,4,199,251,78,60,67,46,122,240,235,162,237,47,245,35,21,21,146,191,112,77,154,29,31,35,184,21,102,170,214,77,35,46,45,58,32,221,206,28,34,115,
+155,61,43,101,7,146,197,175,247,197,99,204,143,170,40,233,236,89,38,143,152,255,26,86,252,251,109,233,52,162,191,140,253,175,207,203,228,219,30,48,63,164,50,233,52,178,191,156,242,217,11,229,237,239,255,
+57,73,100,43,115,240,247,88,34,176,97,234,92,233,127,249,89,50,247,119,207,74,69,121,69,226,210,58,141,28,40,13,155,54,150,77,239,204,15,226,6,126,250,124,57,229,51,23,200,156,7,159,145,205,239,46,50,
+55,201,82,105,214,182,101,32,170,23,61,248,13,121,253,203,191,148,253,121,59,43,243,107,243,208,54,226,40,52,206,105,38,29,134,245,147,252,249,171,147,44,246,153,96,218,230,254,226,164,56,221,209,246,
+250,218,205,247,165,197,151,21,151,164,197,249,26,193,144,63,131,53,95,186,255,128,236,88,180,86,186,159,51,44,233,44,109,250,117,149,166,45,115,130,99,73,7,82,118,102,254,226,9,105,210,50,91,134,125,
+233,50,105,150,219,74,78,255,238,231,100,217,147,111,202,246,121,171,82,82,178,123,172,17,216,240,230,92,209,33,124,251,33,125,147,46,173,199,185,195,204,136,100,89,208,67,109,218,58,71,6,125,254,34,153,
+247,208,243,162,233,85,76,53,28,216,189,79,102,63,240,180,236,52,61,212,161,55,77,76,202,239,114,103,227,212,121,210,103,252,152,36,147,89,13,27,72,207,11,70,200,198,169,149,130,159,116,208,220,23,244,
+218,82,63,169,157,133,164,60,158,237,32,168,25,174,240,245,83,102,139,222,241,163,161,143,233,157,174,127,115,142,25,41,29,233,185,68,143,135,219,58,220,251,224,103,143,139,14,183,206,255,229,173,102,
+184,150,47,139,255,241,122,120,152,239,99,152,64,225,214,93,129,32,246,56,103,104,226,42,117,184,223,117,236,32,83,247,115,131,184,220,129,61,141,191,180,177,17,211,57,137,52,209,141,117,147,103,153,30,
+228,73,209,40,167,219,122,29,221,198,13,9,220,76,161,225,174,103,12,146,194,45,187,100,223,166,237,97,212,145,111,211,59,86,119,65,234,39,171,129,187,94,243,145,147,29,159,91,8,106,134,235,77,125,160,
+234,147,202,233,210,46,56,83,131,70,13,165,231,249,35,69,133,182,54,97,251,252,85,129,31,174,69,215,246,178,224,47,47,37,13,31,107,147,159,52,31,29,129,13,111,169,96,157,26,248,48,245,42,58,143,26,104,
+60,58,89,178,229,253,74,159,122,78,151,220,160,183,87,94,118,200,122,145,69,219,11,204,8,165,185,52,110,209,220,122,252,104,35,15,236,220,27,136,126,247,136,232,235,205,126,221,100,123,219,212,107,249,
+248,163,223,75,251,52,107,215,234,104,47,229,132,201,143,160,102,184,42,203,75,203,140,191,108,129,233,165,142,14,206,164,61,148,162,237,187,101,239,250,109,181,58,115,155,190,93,165,203,152,147,165,120,
+199,30,227,63,189,160,86,121,72,116,108,16,208,97,115,211,54,57,102,216,223,59,184,32,117,253,108,122,119,97,224,15,215,136,146,130,66,105,82,141,88,170,187,167,188,244,144,148,22,30,8,242,103,226,143,
+138,103,56,130,82,223,109,199,225,253,205,112,127,158,245,84,234,67,125,254,154,31,165,125,138,119,236,181,166,247,49,18,65,173,135,90,95,111,26,109,175,139,140,160,154,33,83,111,51,252,175,170,7,144,
+118,41,38,253,168,111,124,74,242,222,95,34,211,239,126,68,58,143,57,69,212,7,71,56,62,8,232,234,140,109,115,86,74,143,179,135,73,56,220,143,14,239,117,88,173,19,84,173,122,117,182,22,40,119,64,15,51,33,
+181,67,116,22,189,54,65,39,65,115,58,182,77,75,154,221,190,117,16,87,90,148,62,121,164,19,97,234,211,111,209,181,157,105,163,35,101,219,236,21,105,147,165,9,131,230,50,74,10,246,167,125,106,123,125,9,
+59,39,240,6,130,90,15,149,27,44,41,49,63,138,94,23,142,12,102,238,117,40,88,155,208,255,242,113,210,170,71,199,96,166,184,96,213,102,89,253,194,123,50,252,214,203,51,54,4,172,205,53,145,166,110,4,130,
+97,191,89,126,212,217,140,50,14,29,40,77,154,80,44,88,157,39,187,150,111,148,129,102,137,92,106,104,156,221,76,250,92,114,154,172,121,249,253,212,67,85,238,239,223,188,67,58,12,237,23,76,100,70,19,117,
+49,126,81,13,251,55,231,71,163,131,109,93,122,183,121,250,34,179,132,106,76,240,89,87,75,87,84,154,33,34,2,2,8,106,61,53,132,245,83,230,200,200,219,174,12,126,80,122,151,175,41,52,239,208,90,134,220,112,
+137,44,124,228,21,41,54,190,46,13,139,254,246,106,240,61,236,230,79,4,223,252,57,246,9,104,15,80,135,245,67,111,156,24,12,165,163,75,168,244,234,213,47,222,195,172,61,61,245,198,143,75,211,214,45,130,
+2,181,238,211,69,206,253,249,45,129,127,117,245,75,201,130,170,126,204,236,78,109,147,62,186,154,64,131,182,177,138,242,114,25,249,181,171,36,119,96,15,209,25,123,157,116,210,229,91,218,243,84,159,172,
+45,168,136,246,191,242,172,96,37,201,150,15,82,214,176,70,51,152,17,83,234,185,117,63,83,62,222,232,169,143,151,109,214,161,214,83,77,233,36,212,41,159,187,80,214,189,97,119,248,167,94,198,200,219,174,
+146,189,27,182,201,42,211,43,13,131,14,233,230,255,233,69,57,253,59,159,13,126,60,249,11,146,215,15,134,233,248,62,118,8,232,26,77,117,217,168,171,230,131,123,31,75,187,48,173,195,169,147,126,47,163,239,
+184,90,6,94,125,158,233,197,30,12,132,48,111,198,98,153,117,255,211,198,135,90,150,148,71,23,253,235,39,26,116,25,214,59,63,120,216,204,204,231,203,140,255,249,167,140,184,245,10,185,240,55,183,7,203,
+176,212,165,160,199,103,253,250,95,209,44,73,219,186,12,79,253,180,91,62,88,26,248,108,147,14,70,118,84,204,39,62,250,253,72,76,229,230,242,167,222,146,5,15,191,156,22,239,99,68,214,83,19,38,213,206,65,
+227,35,29,202,12,129,122,36,160,11,237,179,59,180,49,55,210,237,65,79,51,246,169,181,39,105,252,166,58,33,166,203,183,244,169,44,66,253,16,160,135,90,63,156,57,11,4,106,36,160,189,196,61,133,91,107,76,
+87,99,2,227,175,47,202,47,8,62,53,166,37,129,83,2,248,80,157,226,196,24,4,32,224,51,1,4,213,231,218,167,236,16,128,128,83,2,8,170,83,156,24,131,0,4,124,38,128,160,250,92,251,148,29,2,16,112,74,0,65,117,
+138,19,99,16,128,128,207,4,16,84,159,107,159,178,67,0,2,78,9,32,168,78,113,98,12,2,16,240,153,0,130,234,115,237,83,118,8,64,192,41,1,4,213,41,78,140,65,0,2,62,19,64,80,125,174,125,202,14,1,8,56,37,128,
+160,58,197,137,49,8,64,192,103,2,8,170,207,181,79,217,33,0,1,167,4,16,84,167,56,49,6,1,8,248,76,0,65,245,185,246,41,59,4,32,224,148,0,130,234,20,39,198,32,0,1,159,9,32,168,62,215,62,101,135,0,4,156,18,
+64,80,157,226,196,24,4,32,224,51,1,4,213,231,218,167,236,16,128,128,83,2,8,170,83,156,24,131,0,4,124,38,128,160,250,92,251,148,29,2,16,112,74,0,65,117,138,19,99,16,128,128,207,4,16,84,159,107,159,178,
+67,0,2,78,9,32,168,78,113,98,12,2,16,240,153,0,130,234,115,237,83,118,8,64,192,41,1,4,213,41,78,140,65,0,2,62,19,64,80,125,174,125,202,14,1,8,56,37,128,160,58,197,137,49,8,64,192,103,2,8,170,207,181,79,
+217,33,0,1,167,4,16,84,167,56,49,6,1,8,248,76,0,65,245,185,246,41,59,4,32,224,148,0,130,234,20,39,198,32,0,1,159,9,32,168,62,215,62,101,135,0,4,156,18,64,80,157,226,196,24,4,32,224,51,1,4,213,231,218,
+167,236,16,128,128,83,2,8,170,83,156,24,131,0,4,124,38,128,160,250,92,251,148,29,2,16,112,74,0,65,117,138,19,99,16,128,128,207,4,16,84,159,107,159,178,67,0,2,78,9,32,168,78,113,98,12,2,16,240,153,0,130,
+234,115,237,83,118,8,64,192,41,1,4,213,41,78,140,65,0,2,62,19,64,80,125,174,125,202,14,1,8,56,37,128,160,58,197,137,49,8,64,192,103,2,8,170,207,181,79,217,33,0,1,167,4,16,84,167,56,49,6,1,8,248,76,0,65,
+245,185,246,41,59,4,32,224,148,0,130,234,20,39,198,32,0,1,159,9,32,168,62,215,62,101,135,0,4,156,18,64,80,157,226,196,24,4,32,224,51,1,4,213,231,218,167,236,16,128,128,83,2,8,170,83,156,24,131,0,4,124,
+38,128,160,250,92,251,148,29,2,16,112,74,0,65,117,138,19,99,16,128,128,207,4,16,84,159,107,159,178,67,0,2,78,9,32,168,78,113,98,12,2,16,240,153,0,130,234,115,237,83,118,8,64,192,41,1,4,213,41,78,140,65,
+0,2,62,19,64,80,125,174,125,202,14,1,8,56,37,128,160,58,197,137,49,8,64,192,103,2,8,170,207,181,79,217,33,0,1,167,4,16,84,167,56,49,6,1,8,248,76,0,65,245,185,246,41,59,4,32,224,148,0,130,234,20,39,198,
+32,0,1,159,9,32,168,62,215,62,101,135,0,4,156,18,64,80,157,226,196,24,4,32,224,51,1,4,213,231,218,167,236,16,128,128,83,2,8,170,83,156,24,131,0,4,124,38,128,160,250,92,251,148,29,2,16,112,74,0,65,117,
+138,19,99,16,128,128,207,4,16,84,159,107,159,178,67,0,2,78,9,32,168,78,113,98,12,2,16,240,153,0,130,234,115,237,83,118,8,64,192,41,1,4,213,41,78,140,65,0,2,62,19,64,80,125,174,125,202,14,1,8,56,37,128,
+160,58,197,137,49,8,64,192,103,2,8,170,207,181,79,217,33,0,1,167,4,16,84,167,56,49,6,1,8,248,76,0,65,245,185,246,41,59,4,32,224,148,0,130,234,20,39,198,32,0,1,159,9,32,168,62,215,62,101,135,0,4,156,18,
+64,80,157,226,196,24,4,32,224,51,1,4,213,231,218,167,236,16,128,128,83,2,8,170,83,156,24,131,0,4,124,38,128,160,250,92,251,148,29,2,16,112,74,0,65,117,138,19,99,16,128,128,207,4,16,84,159,107,159,178,
+67,0,2,78,9,32,168,78,113,98,12,2,16,240,153,0,130,234,115,237,83,118,8,64,192,41,1,4,213,41,78,140,65,0,2,62,19,64,80,125,174,125,202,14,1,8,56,37,128,160,58,197,137,49,8,64,192,103,2,8,170,207,181,79,
+217,33,0,1,167,4,16,84,167,56,49,6,1,8,248,76,0,65,245,185,246,41,59,4,32,224,148,0,130,234,20,39,198,32,0,1,159,9,32,168,62,215,62,101,135,0,4,156,18,64,80,157,226,196,24,4,32,224,51,1,4,213,231,218,
+167,236,16,128,128,83,2,8,170,83,156,24,131,0,4,124,38,128,160,250,92,251,148,29,2,16,112,74,0,65,117,138,19,99,16,128,128,207,4,16,84,159,107,159,178,67,0,2,78,9,32,168,78,113,98,12,2,16,240,153,0,130,
+234,115,237,83,118,8,64,192,41,1,4,213,41,78,140,65,0,2,62,19,64,80,125,174,125,202,14,1,8,56,37,128,160,58,197,137,49,8,64,192,103,2,8,170,207,181,79,217,33,0,1,167,4,16,84,167,56,49,6,1,8,248,76,0,65,
+245,185,246,41,59,4,32,224,148,0,130,234,20,39,198,32,0,1,159,9,252,31,227,63,24,36,157,188,51,138,0,0,0,0,73,69,78,68,174,66,96,130,0,0};
+
+// knob.png
+static const unsigned char resource_knob_png[] = { 137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,0,36,0,0,0,36,8,6,0,0,0,225,0,152,152,0,0,0,1,115,82,71,66,0,174,206,28,233,0,0,0,56,101,88,
+73,102,77,77,0,42,0,0,0,8,0,1,135,105,0,4,0,0,0,1,0,0,0,26,0,0,0,0,0,2,160,2,0,4,0,0,0,1,0,0,0,36,160,3,0,4,0,0,0,1,0,0,0,36,0,0,0,0,9,198,193,198,0,0,1,219,73,68,65,84,88,9,205,152,253,109,131,48,16,
+197,3,234,255,161,27,100,131,178,65,189,65,188,65,217,32,221,160,35,148,13,210,13,74,39,128,78,208,100,131,108,80,54,160,239,33,27,25,226,34,243,105,78,122,226,140,125,247,126,178,33,77,26,236,6,70,85,
+85,17,74,142,144,132,152,83,49,196,184,64,165,82,134,235,87,16,4,28,207,31,0,145,80,14,13,141,28,5,114,54,34,52,19,16,155,78,141,28,13,196,36,48,52,56,67,46,113,195,34,202,37,222,7,67,161,107,4,229,46,
+221,177,134,207,74,29,204,29,107,114,172,139,116,93,239,149,11,161,31,200,53,132,110,136,2,30,175,107,208,227,14,42,212,205,140,235,39,242,216,24,47,149,210,131,94,173,104,1,129,248,140,89,209,90,177,
+236,128,59,154,154,22,13,16,38,8,146,152,147,43,229,39,229,93,219,53,64,24,189,173,4,96,179,105,188,107,32,16,74,172,18,182,149,43,221,227,209,145,97,167,119,232,117,37,227,62,155,132,147,33,200,34,92,
+159,57,240,28,71,178,112,135,234,173,242,12,163,237,229,38,129,120,100,91,137,250,200,246,91,161,1,199,158,71,22,111,8,40,214,175,253,102,152,8,116,157,72,243,98,212,159,140,124,76,122,125,64,85,57,166,
+210,168,73,240,249,33,212,248,96,220,31,147,150,115,0,209,248,48,198,221,82,83,242,200,50,203,132,175,91,89,160,254,116,252,250,34,232,248,62,134,234,119,211,119,103,194,199,176,254,13,167,95,251,212,
+7,65,199,243,163,53,198,209,21,144,175,40,90,48,28,128,132,95,146,124,133,184,3,82,80,169,7,162,254,199,5,64,107,30,93,97,221,25,243,38,128,248,67,241,178,194,78,209,35,50,189,255,205,21,212,146,59,197,
+222,110,48,38,37,138,150,120,166,250,159,25,19,192,150,3,138,111,223,28,187,197,30,194,230,49,234,30,154,73,40,131,134,6,107,164,171,105,224,186,80,175,67,115,158,61,13,40,230,212,19,196,224,119,171,82,
+41,195,53,27,250,47,189,63,156,95,130,217,104,24,181,215,0,0,0,0,73,69,78,68,174,66,96,130,0,0};
+
+const char* Resources::bg_png = (const char*) resource_bg_png;
+const char* Resources::knob_png = (const char*) resource_knob_png;
@@ -0,0 +1,19 @@
+/*
+  ==============================================================================
+
+    Resources.h
+
+  ==============================================================================
+*/
+
+#pragma once
+
+// 埋め込み画像はこの1つの翻訳単位にだけ置く (ヘッダにstatic配列を置くとincludeごとにコピーされる)
+namespace Resources
+{
+    extern const char* bg_png;
+    const int bg_pngSize = 13299;
+
+    extern const char* knob_png;
+    const int knob_pngSize = 613;
+}
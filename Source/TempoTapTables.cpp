@@ -0,0 +1,106 @@
+/*
+  ==============================================================================
+
+    TempoTapTables.cpp
+
+  ==============================================================================
+*/
+
+#include "TempoTapTables.h"
+
+TempoTapTables::TempoTapTables()
+    : juce::Thread ("TempoTapTables")
+{
+}
+
+TempoTapTables::~TempoTapTables()
+{
+    stopThread (1000);
+}
+
+// DELAY NOTE / ROOM NOTEの選択肢, getNoteBeats()と同じ順番 (どちらも短い方から並べるので, indexはそのまま音符になる)
+juce::StringArray TempoTapTables::getNoteNames (float maxLength)
+{
+    const juce::StringArray names { "1/256", "1/128", "1/64", "1/32", "1/16", "1/8", "1/4" };
+    juce::StringArray reachable;
+    for (int note = 0; note < numNotes; ++note)
+        if (getNoteBeats (note) * 60000.0 / maxTempo < maxLength) reachable.add (names[note]);
+    return reachable;
+}
+
+float TempoTapTables::getNoteBeats (int note)
+{
+    return 4.0f / (float) (256 >> juce::jlimit (0, numNotes - 1, note));
+}
+
+//==============================================================================
+void TempoTapTables::prepare (double sampleRate, float delayTimeMax, float roomSizeMax)
+{
+    {
+        const juce::ScopedLock sl (buildLock);
+        tapTableCompiler.setSampleRate ((float) sampleRate);
+        this->delayTimeMax = delayTimeMax;
+        this->roomSizeMax = roomSizeMax;
+        prepared = true;
+        builtNotes = -1; // 今の面は前のsampleRateのもの
+    }
+    if (enabled) build (requestedNotes.load());
+}
+
+void TempoTapTables::enable()
+{
+    if (enabled.exchange (true)) return;
+    startThread();
+}
+
+void TempoTapTables::setNotes (int delayNote, int roomNote)
+{
+    auto notes = packNotes (delayNote, roomNote);
+    if (requestedNotes.exchange (notes) != notes) notify();
+}
+
+bool TempoTapTables::getTapTableIfChanged (double tempo, juce::int64& key, MultiTapDelay::TapTable& table) const
+{
+    const juce::SpinLock::ScopedTryLockType lock (swapLock);
+    if (! lock.isLocked() || tables[(size_t) front].empty()) return false;
+
+    auto index = juce::jlimit (0, numTempi - 1, juce::roundToInt ((tempo - minTempo) / tempoStep));
+    auto newKey = ((juce::int64) generation << 32) | (juce::int64) index;
+    if (newKey == key) return false;
+
+    key = newKey;
+    table = tables[(size_t) front][(size_t) index];
+    return true;
+}
+
+//==============================================================================
+void TempoTapTables::build (int notes)
+{
+    const juce::ScopedLock sl (buildLock);
+    if (! prepared) return;
+
+    auto delayBeats = getNoteBeats (notes >> 8);
+    auto roomBeats = getNoteBeats (notes & 0xff);
+
+    auto& back = tables[(size_t) (1 - front)];
+    back.resize ((size_t) numTempi);
+    for (int i = 0; i < numTempi; ++i) {
+        auto msPerBeat = (float) (60000.0 / (minTempo + tempoStep * i));
+        back[(size_t) i] = tapTableCompiler.compileTapTable (juce::jmin (delayTimeMax, delayBeats * msPerBeat),
+                                                            juce::jmin (roomSizeMax, roomBeats * msPerBeat));
+    }
+
+    const juce::SpinLock::ScopedLockType lock (swapLock);
+    front = 1 - front;
+    generation++;
+    builtNotes = notes;
+}
+
+void TempoTapTables::run()
+{
+    while (! threadShouldExit()) {
+        auto notes = requestedNotes.load();
+        if (notes != builtNotes) build (notes);
+        wait (-1); // setNotes()かstopThread()で起きる
+    }
+}
@@ -0,0 +1,74 @@
+/*
+  ==============================================================================
+
+    TempoTapTables.h
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+#include "MultiTapDelay.h"
+
+// テンポ同期用: テンポごとのtap tableを前もって作っておき, audio threadは読むだけにする
+// - テンポはminTempo~maxTempoをtempoStep刻みに量子化, 1つのテンポに1つのtap table (全チャンネル共通)
+// - 音符の長さ(ms)はdelayTimeMax/roomSizeMaxまでに制限 (historyはその長さで確保してある)
+// - SYNCが初めて有効になる (enable()) まではthreadも作らず, tap tableも作らない
+// - sampleRateはprepare()で作り直し, 音符の変更はworker threadで作り直す (変わった時だけ起こす)
+// - 作る面と読む面の2面, 出来上がったら短いロックの中で入れ替えるだけ
+//   audio threadはtry-lockで読み, 取れなかったブロックは今のtap tableのまま (次のブロックでまた読む)
+class TempoTapTables : private juce::Thread
+{
+public:
+    TempoTapTables();
+    ~TempoTapTables() override;
+
+    // maxTempoでmaxLength(ms)より短くなる音符だけ, それより長い音符はどのテンポでもmaxLengthに丸められて区別がつかない
+    static juce::StringArray getNoteNames (float maxLength);
+
+    //------------------------------------------------------------------------
+    // prepareToPlayから呼ぶ, enable()の後なら今の音符で作り終わってから戻る
+    void prepare (double sampleRate, float delayTimeMax, float roomSizeMax);
+
+    // SYNCが有効になった時に呼ぶ (message thread), 初めての時だけworker threadを始める
+    void enable();
+
+    // 変わっていればworker threadを起こして作り直す
+    // notify()はロックを取るので, audio threadからは呼ばない
+    void setNotes (int delayNote, int roomNote);
+
+    // audio thread: keyと違うtap tableになった時だけtableにコピーしてtrue, keyを更新する
+    // keyは音符/sampleRateを作り直すたびに変わるので, 作り直しの後も切り替わる
+    bool getTapTableIfChanged (double tempo, juce::int64& key, MultiTapDelay::TapTable& table) const;
+
+private:
+    void run() override;
+    void build (int notes);
+
+    static float getNoteBeats (int note);
+    static int packNotes (int delayNote, int roomNote) { return (delayNote << 8) | roomNote; }
+
+    static constexpr int numNotes = 7;
+
+    static constexpr double minTempo = 20.0;
+    static constexpr double maxTempo = 300.0;
+    static constexpr double tempoStep = 0.5;
+    static constexpr int numTempi = (int) ((maxTempo - minTempo) / tempoStep) + 1;
+
+    MultiTapDelay tapTableCompiler;
+    float delayTimeMax = 50.0f;
+    float roomSizeMax = 500.0f;
+    bool prepared = false;
+    std::atomic<bool> enabled { false };
+
+    std::atomic<int> requestedNotes { 0 };
+    std::atomic<int> builtNotes { -1 };
+    juce::CriticalSection buildLock;   // prepare()とworker threadが同時に作らない
+
+    std::array<std::vector<MultiTapDelay::TapTable>, 2> tables;
+    int front = 0;                     // audio threadが読む面, swapLockの中で入れ替える
+    int generation = 0;
+    mutable juce::SpinLock swapLock;
+
+    JUCE_DECLARE_NON_COPYABLE (TempoTapTables)
+};
@@ -0,0 +1,112 @@
+/*
+  ==============================================================================
+
+    Trace.cpp
+
+  ==============================================================================
+*/
+
+#include "Trace.h"
+
+#if REVERSEGATE_ENABLE_TRACE
+
+namespace Trace
+{
+    std::atomic<Writer*> Writer::instance { nullptr };
+    std::atomic<int> Writer::nextGeneration { 0 };
+
+    //==============================================================================
+    // 出力先は REVERSEGATE_TRACE=<file>, 無ければtempフォルダ
+    Writer::Writer()
+        : juce::Thread ("Trace")
+    {
+        for (auto& buffer : buffers) buffer = std::make_unique<ThreadBuffer>();
+        generation = ++nextGeneration;
+
+        auto path = juce::SystemStats::getEnvironmentVariable ("REVERSEGATE_TRACE", {});
+        file = path.isNotEmpty() ? juce::File::getCurrentWorkingDirectory().getChildFile (path)
+                                      : juce::File::getSpecialLocation (juce::File::tempDirectory).getChildFile ("REVERSEGATE.trace.json");
+        file.deleteFile();
+        stream = std::make_unique<juce::FileOutputStream> (file);
+        if (stream->failedToOpen()) {
+            stream = nullptr;
+            file = juce::File();
+            return;
+        }
+
+        // 閉じ括弧が無くても読める形式 (JSON Array Format)
+        stream->writeText ("[\n", false, false, nullptr);
+        instance = this;
+        startThread();
+    }
+
+    Writer::~Writer()
+    {
+        instance = nullptr;
+        stopThread (1000);
+        drain();
+        if (stream != nullptr) stream->writeText ("\n]\n", false, false, nullptr);
+    }
+
+    //==============================================================================
+    void Writer::add (const char* name, int channel, juce::int64 startTicks, juce::int64 endTicks)
+    {
+        auto* writer = instance.load();
+        if (writer == nullptr) return;
+
+        auto* buffer = writer->getThreadBuffer();
+        if (buffer == nullptr) return;
+
+        auto scope = buffer->fifo.write (1);
+        if (scope.blockSize1 > 0) buffer->events[(size_t) scope.startIndex1] = { name, channel, startTicks, endTicks }; // 満杯なら捨てる
+    }
+
+    // threadごとに初回だけbufferを割り当てる (Writerが作り直されたら割り当て直す)
+    Writer::ThreadBuffer* Writer::getThreadBuffer()
+    {
+        thread_local int threadGeneration = 0;
+        thread_local int threadIndex = -1;
+        if (threadGeneration != generation) {
+            threadGeneration = generation;
+            threadIndex = numThreads++;
+        }
+        return threadIndex < maxThreads ? buffers[(size_t) threadIndex].get() : nullptr;
+    }
+
+    //==============================================================================
+    void Writer::drain()
+    {
+        if (stream == nullptr) return;
+
+        auto toMicroseconds = [] (juce::int64 ticks) { return juce::String (juce::Time::highResolutionTicksToSeconds (ticks) * 1.0e6, 3); };
+
+        juce::String json;
+        for (int tid = 0; tid < juce::jmin (numThreads.load(), maxThreads); ++tid) {
+            auto& buffer = *buffers[(size_t) tid];
+            auto scope = buffer.fifo.read (buffer.fifo.getNumReady());
+            scope.forEach ([&] (int index)
+            {
+                const auto& event = buffer.events[(size_t) index];
+                json << (firstEvent ? "" : ",\n")
+                     << "{\"name\":\"" << event.name << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << tid
+                     << ",\"ts\":" << toMicroseconds (event.startTicks)
+                     << ",\"dur\":" << toMicroseconds (event.endTicks - event.startTicks);
+                if (event.channel >= 0) json << ",\"args\":{\"channel\":" << event.channel << "}";
+                json << "}";
+                firstEvent = false;
+            });
+        }
+        stream->writeText (json, false, false, nullptr);
+        stream->flush();
+    }
+
+    void Writer::run()
+    {
+        while (! threadShouldExit()) {
+            drain();
+            wait (100);
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,102 @@
+/*
+  ==============================================================================
+
+    Trace.h
+
+  ==============================================================================
+*/
+
+#pragma once
+
+// 処理の区間を計測して, Chrome trace-event形式のJSON (chrome://tracing, Perfettoで開ける) に書き出す
+// REVERSEGATE_ENABLE_TRACE=1 をプリプロセッサ定義に追加した時だけ有効, それ以外はマクロが空になり何も残らない
+//
+//   RG_TRACE_SCOPE("name");                  スコープの終わりまでを1区間として記録
+//   RG_TRACE_SCOPE_CHANNEL("name", channel); チャンネル番号をargsに付ける
+//
+// 記録はthreadごとの確保済みリング (wait-freeなSPSC FIFO) に積むだけで, 書き出しはTrace::Writerのthreadが行う
+// Writerが無い時 (SharedResourcePointerを持つprocessorが無い時) は何も記録しない
+#ifndef REVERSEGATE_ENABLE_TRACE
+ #define REVERSEGATE_ENABLE_TRACE 0
+#endif
+
+#if REVERSEGATE_ENABLE_TRACE
+
+#include <JuceHeader.h>
+
+namespace Trace
+{
+    struct Event
+    {
+        const char* name; // 文字列リテラルだけ
+        int channel;
+        juce::int64 startTicks;
+        juce::int64 endTicks;
+    };
+
+    class Writer : private juce::Thread
+    {
+    public:
+        Writer();
+        ~Writer() override;
+
+        // audio threadなど, どのthreadからでも呼べる (ロックもメモリ確保もしない)
+        static void add (const char* name, int channel, juce::int64 startTicks, juce::int64 endTicks);
+
+        // 書き出し先, 開けなかった時は空のFile
+        const juce::File& getFile() const { return file; }
+
+    private:
+        struct ThreadBuffer
+        {
+            static constexpr int capacity = 8192;
+            juce::AbstractFifo fifo { capacity };
+            std::array<Event, capacity> events;
+        };
+
+        void run() override;
+        void drain();
+        ThreadBuffer* getThreadBuffer();
+
+        static constexpr int maxThreads = 16;
+        std::array<std::unique_ptr<ThreadBuffer>, maxThreads> buffers;
+        std::atomic<int> numThreads { 0 };
+        int generation = 0;
+
+        juce::File file;
+        std::unique_ptr<juce::FileOutputStream> stream;
+        bool firstEvent = true;
+
+        static std::atomic<Writer*> instance;
+        static std::atomic<int> nextGeneration;
+
+        JUCE_DECLARE_NON_COPYABLE (Writer)
+    };
+
+    class Scope
+    {
+    public:
+        Scope (const char* name, int channel = -1) noexcept
+            : name (name), channel (channel), startTicks (juce::Time::getHighResolutionTicks()) {}
+        ~Scope() { Writer::add (name, channel, startTicks, juce::Time::getHighResolutionTicks()); }
+
+    private:
+        const char* name;
+        int channel;
+        juce::int64 startTicks;
+
+        JUCE_DECLARE_NON_COPYABLE (Scope)
+    };
+}
+
+ #define RG_TRACE_CONCAT_INNER(a, b) a##b
+ #define RG_TRACE_CONCAT(a, b) RG_TRACE_CONCAT_INNER(a, b)
+ #define RG_TRACE_SCOPE(name) Trace::Scope RG_TRACE_CONCAT(rgTraceScope, __LINE__) (name)
+ #define RG_TRACE_SCOPE_CHANNEL(name, channel) Trace::Scope RG_TRACE_CONCAT(rgTraceScope, __LINE__) (name, channel)
+
+#else
+
+ #define RG_TRACE_SCOPE(name)
+ #define RG_TRACE_SCOPE_CHANNEL(name, channel)
+
+#endif
@@ -0,0 +1,131 @@
+/*
+  ==============================================================================
+
+    Visualiser.cpp
+
+  ==============================================================================
+*/
+
+#include "Visualiser.h"
+
+Visualiser::Visualiser (VisualiserFeed& f) : feed (f)
+{
+    setInterceptsMouseClicks (false, false);
+}
+
+Visualiser::~Visualiser()
+{
+    feed.setActive (false);
+}
+
+void Visualiser::paint (juce::Graphics& g)
+{
+    auto line = juce::Colours::white.withAlpha (0.8f);
+
+    // impulse response
+    if (g.getClipBounds().intersects (impulseArea))
+    {
+        g.setColour (line.withAlpha (0.3f));
+        g.drawHorizontalLine (impulseArea.getBottom() - 1, (float) impulseArea.getX(), (float) impulseArea.getRight());
+        g.setColour (line);
+        g.strokePath (impulsePath, juce::PathStrokeType (1.0f));
+    }
+
+    // wet level (rms: 塗り, peak: 線), 右端が最新
+    if (g.getClipBounds().intersects (levelArea))
+    {
+        auto barW = (float) levelArea.getWidth() / (float) historySize;
+        auto bottom = (float) levelArea.getBottom();
+        auto h = (float) levelArea.getHeight();
+        for (int i = 0; i < historySize; i++)
+        {
+            auto& frame = history[(size_t) ((historyPos + i) % historySize)];
+            auto x = (float) levelArea.getX() + (float) i * barW;
+            auto rms = juce::jmin (1.0f, frame.rms) * h;
+            auto peak = juce::jmin (1.0f, frame.peak) * h;
+            g.setColour (line.withAlpha (0.4f));
+            g.fillRect (x, bottom - rms, barW, rms);
+            g.setColour (line);
+            g.fillRect (x, bottom - peak, barW, 1.0f);
+        }
+
+        // フェード中は点で表示 (FADE_OUT: 暗い, FADE_IN: 明るい)
+        auto fadeState = history[(size_t) ((historyPos + historySize - 1) % historySize)].fadeState;
+        if (fadeState != 0)
+        {
+            g.setColour (line.withAlpha (fadeState == 1 ? 0.4f : 1.0f));
+            g.fillEllipse ((float) levelArea.getRight() - 5.0f, (float) levelArea.getY(), 4.0f, 4.0f);
+        }
+    }
+}
+
+void Visualiser::resized()
+{
+    auto area = getLocalBounds();
+    impulseArea = area.removeFromLeft (area.getWidth() * 2 / 3).reduced (2);
+    levelArea = area.reduced (2);
+    updateImpulseResponse();
+}
+
+void Visualiser::visibilityChanged()
+{
+    updateTimer();
+}
+
+void Visualiser::parentHierarchyChanged()
+{
+    updateTimer();
+}
+
+void Visualiser::updateTimer()
+{
+    // 見えていない時はタイマーもaudio thread側の計測も止める
+    if (isShowing())
+    {
+        feed.setActive (true);
+        startTimerHz (30);
+    }
+    else
+    {
+        stopTimer();
+        feed.setActive (false);
+    }
+}
+
+void Visualiser::timerCallback()
+{
+    VisualiserFeed::Frame frame;
+    bool levelChanged = false;
+    while (feed.pop (frame))
+    {
+        history[(size_t) historyPos] = frame;
+        historyPos = (historyPos + 1) % historySize;
+        levelChanged = true;
+    }
+    if (levelChanged)
+        repaint (levelArea);
+
+    if (feed.getTapTableVersion() != tapTableVersion)
+    {
+        tapTableVersion = feed.copyTapTable (tapTable);
+        updateImpulseResponse();
+        repaint (impulseArea);
+    }
+}
+
+void Visualiser::updateImpulseResponse()
+{
+    impulsePath.clear();
+    if (tapTableVersion < 0 || impulseArea.isEmpty())
+        return;
+
+    auto maxSample = (float) juce::jmax (1, tapTable.samples.back());
+    auto maxVolume = tapTable.volumes.back();
+    for (int i = 0; i < MultiTapDelay::numTaps; i++)
+    {
+        auto x = (float) impulseArea.getX() + (float) tapTable.samples[(size_t) i] / maxSample * (float) (impulseArea.getWidth() - 1);
+        auto y = (float) impulseArea.getBottom() - tapTable.volumes[(size_t) i] / maxVolume * (float) impulseArea.getHeight();
+        impulsePath.startNewSubPath (x, (float) impulseArea.getBottom());
+        impulsePath.lineTo (x, y);
+    }
+}
@@ -0,0 +1,42 @@
+/*
+  ==============================================================================
+
+    Visualiser.h
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+#include "VisualiserFeed.h"
+
+// 左: tap tableのインパルス応答, 右: wet信号のレベル履歴とフェード状態
+// 表示中だけ低レートのタイマーで動く, インパルス応答はtap tableが変わった時だけ描き直す
+class Visualiser : public juce::Component,
+                   private juce::Timer
+{
+public:
+    Visualiser (VisualiserFeed& feed);
+    ~Visualiser() override;
+
+    void paint (juce::Graphics& g) override;
+    void resized() override;
+    void visibilityChanged() override;
+    void parentHierarchyChanged() override;
+
+private:
+    void timerCallback() override;
+    void updateTimer();
+    void updateImpulseResponse();
+
+    VisualiserFeed& feed;
+
+    juce::Rectangle<int> impulseArea, levelArea;
+    MultiTapDelay::TapTable tapTable;
+    int tapTableVersion = -1;
+    juce::Path impulsePath;
+
+    static constexpr int historySize = 64;
+    std::array<VisualiserFeed::Frame, historySize> history {};
+    int historyPos = 0;
+};
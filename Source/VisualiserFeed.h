@@ -0,0 +1,99 @@
+/*
+  ==============================================================================
+
+    VisualiserFeed.h
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+#include "MultiTapDelay.h"
+
+// audio thread -> Visualiser の受け渡し
+// audio threadは間引いたpeak/RMSをwait-freeなSPSC FIFOに積むだけ, tap tableはtry-lockで公開する
+class VisualiserFeed
+{
+public:
+    struct Frame
+    {
+        float peak;
+        float rms;
+        int fadeState;
+    };
+
+    //------------------------------------------------------------------------
+    // audio thread
+    void prepare(double sampleRate)
+    {
+        samplesPerFrame = juce::jmax(1, (int)(sampleRate / framesPerSecond));
+        peak = 0.0f;
+        sumSquares = 0.0;
+        numSamples = 0;
+    }
+
+    void push(std::vector<MultiTapDelay>& delay)
+    {
+        if (delay.empty()) return;
+
+        for (auto& d : delay) d.takeWetLevel(peak, sumSquares, numSamples);
+        if (numSamples >= samplesPerFrame)
+        {
+            Frame frame { peak, (float)std::sqrt(sumSquares / numSamples), delay[0].getFadeState() };
+            auto write = fifo.write (1);
+            if (write.blockSize1 > 0) frames[(size_t)write.startIndex1] = frame; // 満杯なら捨てる
+            peak = 0.0f;
+            sumSquares = 0.0;
+            numSamples = 0;
+        }
+
+        if (delay[0].getTapTableVersion() != publishedVersion.load())
+        {
+            juce::SpinLock::ScopedTryLockType lock (tapTableLock);
+            if (lock.isLocked())
+            {
+                tapTable = delay[0].getTapTable();
+                publishedVersion = delay[0].getTapTableVersion();
+            }
+        }
+    }
+
+    //------------------------------------------------------------------------
+    // message thread
+    void setActive(bool shouldBeActive) { active = shouldBeActive; }
+    bool isActive() const { return active.load(); }
+
+    bool pop(Frame& frame)
+    {
+        auto read = fifo.read (1);
+        if (read.blockSize1 == 0) return false;
+        frame = frames[(size_t)read.startIndex1];
+        return true;
+    }
+
+    int getTapTableVersion() const { return publishedVersion.load(); }
+
+    int copyTapTable(MultiTapDelay::TapTable& dest)
+    {
+        const juce::SpinLock::ScopedLockType lock (tapTableLock);
+        dest = tapTable;
+        return publishedVersion.load();
+    }
+
+    static constexpr int framesPerSecond = 60;
+
+private:
+    static constexpr int fifoSize = 256;
+    juce::AbstractFifo fifo { fifoSize };
+    std::array<Frame, fifoSize> frames;
+    std::atomic<bool> active { false };
+
+    int samplesPerFrame = 735;
+    float peak = 0.0f;
+    double sumSquares = 0.0;
+    int numSamples = 0;
+
+    juce::SpinLock tapTableLock;
+    MultiTapDelay::TapTable tapTable;
+    std::atomic<int> publishedVersion { -1 };
+};
@@ -0,0 +1,132 @@
+/*
+  ==============================================================================
+
+    BatchEngineTests.cpp
+
+  ==============================================================================
+*/
+
+#include "TestSignals.h"
+#include "../Source/BatchEngine.h"
+
+// BatchEngineの出力が, ストリームごとのMultiTapDelay (パラメータ変更 = switchTapTable()) とビット単位で同じか
+// maxBlockSizeより長いブロック, 途中のパラメータ変更 (50msのクロスフェード), QUALITY_OFFLINE, linearも通す
+class BatchEngineTests : public juce::UnitTest
+{
+public:
+    BatchEngineTests() : juce::UnitTest ("Batch engine matches MultiTapDelay", "Batch") {}
+
+    void runTest() override
+    {
+        for (auto quality : { MultiTapDelay::QUALITY_REALTIME, MultiTapDelay::QUALITY_OFFLINE }) {
+            for (bool linear : { false, true }) {
+                for (int hostBlockSize : { 256, 1000 }) {
+                    beginTest (juce::String (quality == MultiTapDelay::QUALITY_OFFLINE ? "offline" : "realtime")
+                               + (linear ? ", linear" : "") + ", host block " + juce::String (hostBlockSize));
+                    expectEquals (countMismatches (quality, linear, hostBlockSize), 0);
+                }
+            }
+        }
+
+        beginTest ("Unused groups are released");
+        {
+            BatchEngine engine (sampleRate, maxBlockSize, 50.0f, 500.0f);
+            BatchEngine::StreamParameters parameters;
+            engine.addStream (2, parameters);
+            engine.addStream (1, parameters);
+            juce::AudioBuffer<float> stereo (2, maxBlockSize), mono (1, maxBlockSize);
+            juce::AudioBuffer<float>* buffers[] = { &stereo, &mono };
+
+            for (int i = 0; i < 200; i++) {
+                parameters.delayTime = (float) (i % 50);
+                engine.setParameters (0, parameters);
+                engine.process (buffers, maxBlockSize);
+            }
+            parameters.delayTime = 15.0f;
+            engine.setParameters (0, parameters);
+            for (int i = 0; i < 10; i++) engine.process (buffers, maxBlockSize); // クロスフェードが終わるまで
+            expectEquals (engine.getNumGroups(), 1);
+        }
+    }
+
+private:
+    static int countMismatches (MultiTapDelay::Quality quality, bool linear, int hostBlockSize)
+    {
+        const int numStreams = 24;
+        BatchEngine engine (sampleRate, maxBlockSize, 50.0f, 500.0f, quality, 4);
+        std::vector<BatchEngine::StreamParameters> parameters ((size_t) numStreams);
+        std::vector<MultiTapDelay> reference ((size_t) numStreams * 2);
+        std::vector<juce::AudioBuffer<float>> engineBuffers, referenceBuffers;
+        std::vector<juce::AudioBuffer<float>*> bufferPointers;
+
+        for (int s = 0; s < numStreams; s++) {
+            auto& p = parameters[(size_t) s];
+            p.delayTime = 5.0f + (float) (s % 3) * 5.0f;
+            p.roomSize = 10.0f + (float) (s % 4) * 7.5f;
+            p.mix = 60.0f + (float) (s % 40);
+            p.volume = 0.9f;
+            p.linear = linear;
+            const int numChannels = s % 2 == 0 ? 1 : 2;
+            engine.addStream (numChannels, p);
+            engineBuffers.emplace_back (numChannels, hostBlockSize);
+            referenceBuffers.emplace_back (numChannels, hostBlockSize);
+
+            for (int channel = 0; channel < 2; ++channel) {
+                auto& delay = reference[(size_t) (s * 2 + channel)];
+                TestSignals::Config config { "", sampleRate, 1, p.delayTime, p.roomSize, p.mix, p.volume, 0.0f, quality, linear };
+                TestSignals::setUp (delay, config, hostBlockSize);
+            }
+        }
+        for (auto& buffer : engineBuffers) bufferPointers.push_back (&buffer);
+
+        TestSignals::Noise noise (77);
+        int mismatches = 0;
+        for (int block = 0; block < 120; block++) {
+            // 途中でいくつかのストリームのパラメータを変える
+            if (block % 17 == 5) {
+                for (int s = block % 5; s < numStreams; s += 5) {
+                    auto& p = parameters[(size_t) s];
+                    p.delayTime = 5.0f + (float) ((s + block) % 4) * 10.0f;
+                    p.roomSize = 10.0f + (float) (block % 3) * 20.0f;
+                    p.mix = 50.0f;
+                    engine.setParameters (s, p);
+                    for (int channel = 0; channel < 2; ++channel) {
+                        auto& delay = reference[(size_t) (s * 2 + channel)];
+                        delay.setMix (p.mix);
+                        if (delay.getTapTable().delayTime != p.delayTime || delay.getTapTable().roomSize != p.roomSize)
+                            delay.switchTapTable (delay.compileTapTable (p.delayTime, p.roomSize));
+                    }
+                }
+            }
+
+            // 1E-4の閾値より小さいブロックも混ぜる
+            const float level = (block / 10) % 3 == 0 ? 5.0e-5f : 0.4f;
+            for (int s = 0; s < numStreams; s++) {
+                for (int channel = 0; channel < engineBuffers[(size_t) s].getNumChannels(); ++channel) {
+                    for (int i = 0; i < hostBlockSize; i++) {
+                        auto value = level * noise.nextFloat();
+                        engineBuffers[(size_t) s].setSample (channel, i, value);
+                        referenceBuffers[(size_t) s].setSample (channel, i, value);
+                    }
+                }
+            }
+
+            engine.process (bufferPointers.data(), hostBlockSize);
+            for (int s = 0; s < numStreams; s++) {
+                auto& buffer = referenceBuffers[(size_t) s];
+                for (int channel = 0; channel < buffer.getNumChannels(); ++channel) {
+                    reference[(size_t) (s * 2 + channel)].process (buffer, channel, 0, hostBlockSize);
+                    for (int i = 0; i < hostBlockSize; i++)
+                        if (buffer.getSample (channel, i) != engineBuffers[(size_t) s].getSample (channel, i))
+                            mismatches++;
+                }
+            }
+        }
+        return mismatches;
+    }
+
+    static constexpr double sampleRate = 48000.0;
+    static constexpr int maxBlockSize = 256;
+};
+
+static BatchEngineTests batchEngineTests;
@@ -0,0 +1,50 @@
+/*
+  ==============================================================================
+
+    EditorTests.cpp
+
+  ==============================================================================
+*/
+
+#include <JuceHeader.h>
+#include "../Source/PluginProcessor.h"
+#include "../Source/EditorAssets.h"
+#include "../Source/EditorTimings.h"
+
+// エディタを開く時間 (セッション読み込みでまとめて開く時), 画像のデコード時間
+// エディタはデコードを待たずにプレースホルダで開くので, 開く時間はデコード時間に関係なく短いはず
+class EditorTests : public juce::UnitTest
+{
+public:
+    EditorTests() : juce::UnitTest ("Editor open time", "Editor") {}
+
+    void runTest() override
+    {
+        beginTest ("Open many editors");
+        {
+            REVERSEGATEAudioProcessor processor;
+            EditorTimings::reset();
+            const int numEditors = 32;
+            for (int i = 0; i < numEditors; i++)
+                std::unique_ptr<juce::AudioProcessorEditor> editor (processor.createEditor());
+
+            expectEquals ((int) EditorTimings::getNumEditorOpens(), numEditors);
+            logMessage ("  " + juce::String (numEditors) + " editors: mean " + juce::String (EditorTimings::getEditorOpenMsTotal() / numEditors, 3)
+                        + " ms, max " + juce::String (EditorTimings::getEditorOpenMsMax(), 3) + " ms");
+           #if ! JUCE_DEBUG
+            expectLessOrEqual (EditorTimings::getEditorOpenMsMax(), 50.0, "editor open should not wait for image decoding");
+           #endif
+        }
+
+        beginTest ("Image decoding");
+        {
+            auto* assets = EditorAssets::getInstance();
+            for (int waited = 0; ! assets->isLoaded() && waited < 5000; waited += 10)
+                juce::Thread::sleep (10);
+            expect (assets->isLoaded());
+            logMessage ("  decoded once in " + juce::String (EditorTimings::getDecodeMs(), 3) + " ms");
+        }
+    }
+};
+
+static EditorTests editorTests;
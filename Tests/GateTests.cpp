@@ -0,0 +1,99 @@
+/*
+  ==============================================================================
+
+    GateTests.cpp
+
+  ==============================================================================
+*/
+
+#include "TestSignals.h"
+#include "../Source/PluginProcessor.h"
+
+// processBlockを通したMIDIゲートのタイミング (GATE MODE = NOTE)
+// MIX 100なのでdryは出ない, 入力は一定値, ノートはブロックの途中に入る:
+//   note-on  : それより前の入力はタップから読まないので, 出力はちょうど「イベントの位置 + 1本目のタップ」から0でなくなる
+//   retrigger: 押したままのnote-on, そこから1本目のタップまで出力は0に戻り, その位置からまた鳴る
+class GateTests : public juce::UnitTest
+{
+public:
+    GateTests() : juce::UnitTest ("MIDI gate timing", "Gate") {}
+
+    void runTest() override
+    {
+        const double sampleRate = 48000.0;
+        const int blockSize = 512;
+        const int noteOn = 3 * blockSize + 300;
+        const int retrigger = 9 * blockSize + 137;
+        const int numSamples = 14 * blockSize;
+
+        REVERSEGATEAudioProcessor processor;
+        setValue (processor, "DELAY TIME", 8.0f);
+        setValue (processor, "ROOM SIZE", 5.0f);
+        setValue (processor, "MIX", 100.0f);
+        setValue (processor, "VOLUME", 1.0f);
+        setValue (processor, "QUALITY", 1.0f);      // REALTIME
+        setValue (processor, "GATE MODE", 1.0f);    // NOTE
+        processor.setRateAndBufferSizeDetails (sampleRate, blockSize);
+        processor.prepareToPlay (sampleRate, blockSize);
+
+        MultiTapDelay reference;
+        reference.setSampleRate ((float) sampleRate);
+        const int firstTap = reference.compileTapTable (8.0f, 5.0f).samples[0];
+        expectLessThan (noteOn + firstTap, retrigger, "the first note should sound before the retrigger");
+
+        juce::MidiBuffer midi;
+        {
+            // prepareToPlayで始まるフェードが終わるまで, ゲートを閉じたまま流しておく
+            juce::AudioBuffer<float> settle (2, blockSize);
+            for (int done = 0; done < (int) (0.1 * sampleRate); done += blockSize) {
+                fillInput (settle);
+                processor.processBlock (settle, midi);
+            }
+        }
+
+        juce::AudioBuffer<float> output (2, numSamples);
+        for (int start = 0; start < numSamples; start += blockSize) {
+            midi.clear();
+            if (noteOn >= start && noteOn < start + blockSize)
+                midi.addEvent (juce::MidiMessage::noteOn (1, 60, (juce::uint8) 100), noteOn - start);
+            if (retrigger >= start && retrigger < start + blockSize)
+                midi.addEvent (juce::MidiMessage::noteOn (1, 64, (juce::uint8) 100), retrigger - start);
+
+            juce::AudioBuffer<float> block (output.getArrayOfWritePointers(), 2, start, blockSize);
+            fillInput (block);
+            processor.processBlock (block, midi);
+        }
+        processor.releaseResources();
+
+        beginTest ("Note-on opens at the event sample + first tap");
+        expectEquals (getFirstNonZero (output, 0), noteOn + firstTap);
+
+        beginTest ("Retrigger restarts the taps at the event sample");
+        expect (output.getSample (0, retrigger - 1) != 0.0f, "should still sound just before the retrigger");
+        expectEquals (getFirstNonZero (output, retrigger), retrigger + firstTap);
+    }
+
+private:
+    static void fillInput (juce::AudioBuffer<float>& buffer)
+    {
+        for (int channel = 0; channel < buffer.getNumChannels(); ++channel)
+            juce::FloatVectorOperations::fill (buffer.getWritePointer (channel), 0.5f, buffer.getNumSamples());
+    }
+
+    // from以降で, どちらかのチャンネルが最初に0でなくなるサンプル
+    static int getFirstNonZero (const juce::AudioBuffer<float>& buffer, int from)
+    {
+        for (int i = from; i < buffer.getNumSamples(); i++)
+            for (int channel = 0; channel < buffer.getNumChannels(); ++channel)
+                if (buffer.getSample (channel, i) != 0.0f) return i;
+        return -1;
+    }
+
+    static void setValue (REVERSEGATEAudioProcessor& processor, const juce::String& parameterID, float value)
+    {
+        auto* param = processor.parameters.getParameter (parameterID);
+        param->setValueNotifyingHost (param->convertTo0to1 (value));
+    }
+};
+
+static GateTests gateTests;
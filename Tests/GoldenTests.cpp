@@ -0,0 +1,270 @@
+/*
+  ==============================================================================
+
+    GoldenTests.cpp
+
+  ==============================================================================
+*/
+
+#include "TestSignals.h"
+#include "../Source/PluginProcessor.h"
+
+// 決まった信号をいくつかの設定で鳴らし, 保存してある参照出力と比べる
+// 許容差はコンパイラ/CPUによる丸めの違い (FMAなど) だけ, 音が変わる変更なら必ず超える
+// MultiTapDelay単体の設定ごとの参照と, processBlockを通した参照 (パラメータ, MIDIのゲート, BYPASSのランプ) がある
+class GoldenTests : public juce::UnitTest
+{
+public:
+    GoldenTests() : juce::UnitTest ("Golden output", "Golden") {}
+
+    void runTest() override
+    {
+        for (auto& config : TestSignals::getConfigs()) {
+            for (int signal = 0; signal < TestSignals::numSignals; ++signal) {
+                auto name = TestSignals::getReferenceName (config, signal);
+                beginTest (name);
+                expectMatchesReference (TestSignals::render (config, signal), name);
+            }
+        }
+
+        beginTest (processorReferenceName);
+        expectMatchesReference (renderProcessor(), processorReferenceName);
+
+        // 入力が止まったら, 一番遠いタップを過ぎた所から出力はちょうど0 (eco tailの確認も兼ねる)
+        for (auto& config : TestSignals::getConfigs()) {
+            beginTest (juce::String ("Silence drains to zero: ") + config.name);
+
+            MultiTapDelay delay;
+            TestSignals::setUp (delay, config, 512);
+
+            const int burst = 2048;
+            const int drained = burst + TestSignals::getLongestTap (delay) + 1;
+            auto buffer = TestSignals::makeSignal (TestSignals::SIGNAL_NOISE, config.sampleRate, config.numChannels, drained + 4096);
+            for (int channel = 0; channel < buffer.getNumChannels(); ++channel)
+                buffer.clear (channel, burst, buffer.getNumSamples() - burst);
+            TestSignals::process (delay, buffer, 512, 7);
+
+            int nonZero = 0;
+            for (int channel = 0; channel < buffer.getNumChannels(); ++channel)
+                for (int i = drained; i < buffer.getNumSamples(); i++)
+                    if (buffer.getSample (channel, i) != 0.0f) nonZero++;
+            expectEquals (nonZero, 0);
+        }
+
+        // linearならインパルスの出力はgetImpulseResponse()そのもの (L/RペアのRはwidthのずれた位置にタップが立つ)
+        for (auto& config : TestSignals::getConfigs()) {
+            if (! config.linear) continue;
+            beginTest (juce::String ("Linear impulse matches getImpulseResponse: ") + config.name);
+
+            MultiTapDelay delay;
+            TestSignals::setUp (delay, config, 512);
+            auto output = TestSignals::render (config, TestSignals::SIGNAL_IMPULSE);
+            float maxError = 0.0f;
+            for (int lane = 0; lane < config.numChannels; ++lane) {
+                auto response = delay.getImpulseResponse (delay.getTapTable(), lane);
+                const int impulseAt = lane * 17; // makeSignal()のインパルスの位置
+                for (int i = 0; i < output.getNumSamples(); i++) {
+                    const int k = i - impulseAt;
+                    const float expected = k >= 0 && k < (int) response.size() ? response[(size_t) k] : 0.0f;
+                    maxError = juce::jmax (maxError, std::abs (output.getSample (lane, i) - expected));
+                }
+            }
+            expectLessOrEqual (maxError, 1.0e-6f);
+        }
+
+        // BYPASSのランプ中にprepareToPlayより大きいブロックが来ても, 小さいブロックで流したのと同じ出力 (dryBufferはチャンクごとに使う)
+        beginTest ("Bypass ramp in blocks larger than prepared");
+        {
+            auto input = TestSignals::makeSignal (TestSignals::SIGNAL_NOISE, 48000.0, 2, 8192);
+            auto large = renderBypassRamp (input, 4096);
+            auto small = renderBypassRamp (input, 256);
+            float maxError = 0.0f;
+            for (int channel = 0; channel < 2; ++channel)
+                for (int i = 0; i < input.getNumSamples(); i++)
+                    maxError = juce::jmax (maxError, std::abs (large.getSample (channel, i) - small.getSample (channel, i)));
+            expectLessOrEqual (maxError, tolerance);
+        }
+    }
+
+    // 参照出力を書き出す (Main.cppの --write-references)
+    static bool writeReferences (const juce::File& directory)
+    {
+        if (! directory.createDirectory()) return false;
+
+        for (auto& config : TestSignals::getConfigs()) {
+            for (int signal = 0; signal < TestSignals::numSignals; ++signal) {
+                auto name = TestSignals::getReferenceName (config, signal);
+                if (! writeReference (directory.getChildFile (name), TestSignals::render (config, signal))) return false;
+            }
+        }
+        return writeReference (directory.getChildFile (processorReferenceName), renderProcessor());
+    }
+
+private:
+    void expectMatchesReference (const juce::AudioBuffer<float>& output, const juce::String& name)
+    {
+        int size = 0;
+        auto* data = BinaryData::getNamedResource (name.replaceCharacter ('.', '_').toRawUTF8(), size);
+        const int numValues = output.getNumChannels() * output.getNumSamples();
+        if (data == nullptr || size != numValues * (int) sizeof (float)) {
+            expect (false, "reference missing or wrong size: " + name);
+            return;
+        }
+
+        juce::MemoryInputStream reference (data, (size_t) size, false);
+        float maxError = 0.0f;
+        for (int i = 0; i < output.getNumSamples(); i++)
+            for (int channel = 0; channel < output.getNumChannels(); ++channel)
+                maxError = juce::jmax (maxError, std::abs (output.getSample (channel, i) - reference.readFloat()));
+        expectLessOrEqual (maxError, tolerance, name);
+    }
+
+    static bool writeReference (const juce::File& file, const juce::AudioBuffer<float>& output)
+    {
+        file.deleteFile();
+        juce::FileOutputStream stream (file);
+        if (stream.failedToOpen()) return false;
+
+        for (int i = 0; i < output.getNumSamples(); i++)
+            for (int channel = 0; channel < output.getNumChannels(); ++channel)
+                stream.writeFloat (output.getSample (channel, i));
+        return stream.getStatus().wasOk();
+    }
+
+    //==============================================================================
+    // processBlockを通した参照 (stereo 48k, L/Rペア, WIDTHあり, GATE MODE = NOTE)
+    // ホストのブロック長はばらばら, ノートはブロックの途中に入る, パラメータはブロックの境目で変える:
+    //   ノートで開く -> 閉じる -> 開いたまま重ねてretrigger, MIXの変更, BYPASSのオン/オフ (10msのランプ), tailの途中で閉じる
+    struct ProcessorEvent
+    {
+        int samplePosition;
+        const char* parameterID;    // nullptrならMIDI
+        float value;                // パラメータの値, MIDIはノート番号 (負ならnote-off)
+    };
+
+    static juce::AudioBuffer<float> renderProcessor()
+    {
+        const double sampleRate = 48000.0;
+        const int maxBlockSize = 512;
+        const int inputLength = 16000;
+        const ProcessorEvent events[] =
+        {
+            {   700, nullptr,    60.0f },
+            {  3000, "MIX",      60.0f },
+            {  5100, nullptr,   -60.0f },
+            {  6500, nullptr,    64.0f },
+            {  7300, nullptr,    67.0f },   // 押したままのnote-on = retrigger
+            {  8000, "BYPASS",    1.0f },
+            { 10000, "BYPASS",    0.0f },
+            { 11000, nullptr,   -64.0f },
+            { 20000, nullptr,   -67.0f },   // 入力が止まった後, wetのtailの途中で閉じる
+        };
+
+        REVERSEGATEAudioProcessor processor;
+        setValue (processor, "DELAY TIME", 8.0f);
+        setValue (processor, "ROOM SIZE", 5.0f);
+        setValue (processor, "MIX", 80.0f);
+        setValue (processor, "VOLUME", 0.9f);
+        setValue (processor, "WIDTH", 40.0f);
+        setValue (processor, "QUALITY", 1.0f);      // REALTIME
+        setValue (processor, "GATE MODE", 1.0f);    // NOTE
+        processor.setRateAndBufferSizeDetails (sampleRate, maxBlockSize);
+        processor.prepareToPlay (sampleRate, maxBlockSize);
+
+        juce::MidiBuffer midi;
+        {
+            // prepareToPlayで始まるフェードが終わるまで無音を流しておく
+            juce::AudioBuffer<float> silence (2, maxBlockSize);
+            for (int done = 0; done < (int) (0.1 * sampleRate); done += maxBlockSize) {
+                silence.clear();
+                processor.processBlock (silence, midi);
+            }
+        }
+
+        MultiTapDelay reference;
+        reference.setNumLanes (2);
+        reference.setWidth (40.0f);
+        reference.setRoomSizeMax (500.0f);
+        reference.setDelayTimeMax (50.0f);
+        reference.prepare ((float) sampleRate, maxBlockSize);
+        reference.switchTapTable (reference.compileTapTable (8.0f, 5.0f));
+
+        auto input = TestSignals::makeSignal (TestSignals::SIGNAL_NOISE, sampleRate, 2, inputLength);
+        juce::AudioBuffer<float> output (2, inputLength + TestSignals::getLongestTap (reference) + TestSignals::tailLength);
+        output.clear();
+        for (int channel = 0; channel < 2; ++channel)
+            output.copyFrom (channel, 0, input, channel, 0, inputLength);
+
+        TestSignals::Noise blockSizes (99);
+        size_t nextEvent = 0;
+        for (int start = 0; start < output.getNumSamples();) {
+            int n = juce::jmin (output.getNumSamples() - start, 1 + (int) (blockSizes.nextInt() % (juce::uint32) maxBlockSize));
+
+            // パラメータはブロックの頭で変える, そこでブロックを切る
+            for (size_t e = nextEvent; e < (size_t) juce::numElementsInArray (events); e++) {
+                if (events[e].parameterID != nullptr && events[e].samplePosition > start) {
+                    n = juce::jmin (n, events[e].samplePosition - start);
+                    break;
+                }
+            }
+            midi.clear();
+            for (; nextEvent < (size_t) juce::numElementsInArray (events) && events[nextEvent].samplePosition < start + n; nextEvent++) {
+                const auto& event = events[nextEvent];
+                if (event.parameterID != nullptr) setValue (processor, event.parameterID, event.value);
+                else if (event.value > 0.0f) midi.addEvent (juce::MidiMessage::noteOn (1, (int) event.value, (juce::uint8) 100), event.samplePosition - start);
+                else midi.addEvent (juce::MidiMessage::noteOff (1, (int) -event.value), event.samplePosition - start);
+            }
+
+            juce::AudioBuffer<float> block (output.getArrayOfWritePointers(), 2, start, n);
+            processor.processBlock (block, midi);
+            start += n;
+        }
+        processor.releaseResources();
+        return output;
+    }
+
+    // 512で準備して, 前半はBYPASSをオン, 後半はオフにして (どちらも10msのランプ) blockSizeずつ流す
+    static juce::AudioBuffer<float> renderBypassRamp (const juce::AudioBuffer<float>& input, int blockSize)
+    {
+        const double sampleRate = 48000.0;
+        REVERSEGATEAudioProcessor processor;
+        setValue (processor, "DELAY TIME", 8.0f);
+        setValue (processor, "ROOM SIZE", 5.0f);
+        setValue (processor, "MIX", 80.0f);
+        setValue (processor, "QUALITY", 1.0f);      // REALTIME
+        processor.setRateAndBufferSizeDetails (sampleRate, 512);
+        processor.prepareToPlay (sampleRate, 512);
+
+        juce::MidiBuffer midi;
+        juce::AudioBuffer<float> silence (2, 512);
+        for (int done = 0; done < (int) (0.1 * sampleRate); done += 512) {
+            silence.clear();
+            processor.processBlock (silence, midi);
+        }
+
+        juce::AudioBuffer<float> output (input);
+        for (int start = 0; start < output.getNumSamples(); start += blockSize) {
+            setValue (processor, "BYPASS", start < output.getNumSamples() / 2 ? 1.0f : 0.0f);
+            juce::AudioBuffer<float> block (output.getArrayOfWritePointers(), 2, start, juce::jmin (blockSize, output.getNumSamples() - start));
+            processor.processBlock (block, midi);
+        }
+        processor.releaseResources();
+        return output;
+    }
+
+    static void setValue (REVERSEGATEAudioProcessor& processor, const juce::String& parameterID, float value)
+    {
+        auto* param = processor.parameters.getParameter (parameterID);
+        param->setValueNotifyingHost (param->convertTo0to1 (value));
+    }
+
+    static constexpr float tolerance = 1.0e-5f;
+    static constexpr const char* processorReferenceName = "processor_stereo48k.f32";
+};
+
+static GoldenTests goldenTests;
+
+bool writeGoldenReferences (const juce::File& directory)
+{
+    return GoldenTests::writeReferences (directory);
+}
@@ -0,0 +1,92 @@
+/*
+  ==============================================================================
+
+    Main.cpp
+
+  ==============================================================================
+*/
+
+#include <JuceHeader.h>
+#include "../Source/EventRecorder.h"
+#include "Tools.h"
+
+bool writeGoldenReferences (const juce::File& directory);
+
+// ヘッドレスのテスト/ツール
+//   (引数なし) [--category <name>]   テストを実行, 失敗が1つでもあれば終了コード1
+//   --write-references <dir>         GoldenTestsの参照出力を書き出す (音が変わる変更をした時だけ)
+//   --replay <file>                  REVERSEGATE_RECORDで記録したファイルを処理し直して, 記録と食い違ったら終了コード1
+//   --export-ir <state> <out> [--rate <Hz>]
+//                                    getStateInformation()で保存した状態を読み込み, そのインパルス応答を.wavかraw floatで書き出す
+int main (int argc, char* argv[])
+{
+    juce::ScopedJuceInitialiser_GUI juceInitialiser; // processorとエディタの素材がMessageManagerを使う
+
+    juce::ConsoleApplication app;
+    app.addHelpCommand ("--help|-h", "REVERSE GATE tests and tools", true);
+
+    app.addDefaultCommand ({ "", "[--category <name>]",
+                             "Runs the unit tests, or only one category (Golden, Performance, ...)", {},
+                             [] (const juce::ArgumentList& args)
+                             {
+                                 juce::UnitTestRunner runner;
+                                 runner.setAssertOnFailure (false);
+                                 auto category = args.getValueForOption ("--category");
+                                 if (category.isNotEmpty()) runner.runTestsInCategory (category);
+                                 else runner.runAllTests();
+
+                                 int failures = 0;
+                                 for (int i = 0; i < runner.getNumResults(); ++i)
+                                     failures += runner.getResult (i)->failures;
+                                 if (failures > 0)
+                                     juce::ConsoleApplication::fail (juce::String (failures) + " test(s) failed");
+                             } });
+
+    app.addCommand ({ "--write-references", "--write-references <dir>",
+                      "Renders the golden test signals and writes the reference outputs to <dir>", {},
+                      [] (const juce::ArgumentList& args)
+                      {
+                          auto directory = args.getFileForOption ("--write-references");
+                          if (! writeGoldenReferences (directory))
+                              juce::ConsoleApplication::fail ("could not write to " + directory.getFullPathName());
+                      } });
+
+    app.addCommand ({ "--replay", "--replay <file>",
+                      "Re-runs a recording made with REVERSEGATE_RECORD and checks it against the recorded fade states", {},
+                      [] (const juce::ArgumentList& args)
+                      {
+                          auto file = args.getExistingFileForOption ("--replay");
+                          auto result = EventRecorder::replay (file);
+                          if (! result.opened)
+                              juce::ConsoleApplication::fail ("not a recording: " + file.getFullPathName());
+
+                          std::cout << result.numBlocks << " blocks, " << result.numDroppedGaps << " dropped gap(s), "
+                                    << result.numFadeMismatches << " fade state mismatch(es)" << std::endl;
+                          if (result.numFadeMismatches > 0)
+                              juce::ConsoleApplication::fail ("first mismatch at tick " + juce::String (result.firstMismatchTicks));
+                      } });
+
+    app.addCommand ({ "--export-ir", "--export-ir <state file> <out.wav|out.f32> [--rate <Hz>]",
+                      "Loads a saved plugin state and writes its impulse response (SYNC uses 120 BPM, default rate 48000)", {},
+                      [] (const juce::ArgumentList& args)
+                      {
+                          auto index = args.indexOfOption ("--export-ir");
+                          if (index + 2 >= args.size())
+                              juce::ConsoleApplication::fail ("usage: --export-ir <state file> <out.wav|out.f32> [--rate <Hz>]");
+                          auto stateFile = args[index + 1].resolveAsExistingFile();
+                          auto outputFile = args[index + 2].resolveAsFile();
+                          auto rate = args.getValueForOption ("--rate");
+                          auto sampleRate = rate.isNotEmpty() ? rate.getDoubleValue() : 48000.0;
+                          if (sampleRate <= 0.0)
+                              juce::ConsoleApplication::fail ("bad sample rate: " + rate);
+
+                          juce::MemoryBlock state;
+                          if (! stateFile.loadFileAsData (state))
+                              juce::ConsoleApplication::fail ("could not read " + stateFile.getFullPathName());
+                          if (! Tools::exportImpulseResponse (state, sampleRate, outputFile))
+                              juce::ConsoleApplication::fail ("could not write " + outputFile.getFullPathName());
+                          std::cout << "wrote " << outputFile.getFullPathName() << std::endl;
+                      } });
+
+    return app.findAndRunCommand (argc, argv);
+}
@@ -0,0 +1,164 @@
+/*
+  ==============================================================================
+
+    PerformanceTests.cpp
+
+  ==============================================================================
+*/
+
+#include "TestSignals.h"
+#include "../Source/PluginProcessor.h"
+#include "../Source/BatchEngine.h"
+
+// 設定ごとの処理速度の下限 (何倍速で処理できるか), 下回ったら失敗にする
+// 下限は遅めのノートPCでも通る値にしてある, デバッグビルドでは測らない
+class PerformanceTests : public juce::UnitTest
+{
+public:
+    PerformanceTests() : juce::UnitTest ("Throughput floors", "Performance") {}
+
+    void runTest() override
+    {
+       #if JUCE_DEBUG
+        beginTest ("Throughput floors");
+        logMessage ("skipped in debug builds");
+       #else
+        struct Floor
+        {
+            TestSignals::Config config;
+            double minRealtimeFactor;
+        };
+        const Floor floors[] =
+        {
+            { { "mono48k",         48000.0, 1, 30.0f, 15.0f, 50.0f, 0.8f,  0.0f, MultiTapDelay::QUALITY_REALTIME, false }, 40.0 },
+            { { "pair48k",         48000.0, 2, 30.0f, 15.0f, 50.0f, 0.8f, 50.0f, MultiTapDelay::QUALITY_REALTIME, false }, 25.0 },
+            { { "mono48k_offline", 48000.0, 1, 30.0f, 15.0f, 50.0f, 0.8f,  0.0f, MultiTapDelay::QUALITY_OFFLINE,  false }, 30.0 },
+        };
+
+        for (auto& floor : floors) {
+            beginTest (floor.config.name);
+
+            MultiTapDelay delay;
+            TestSignals::setUp (delay, floor.config, blockSize);
+            auto input = TestSignals::makeSignal (TestSignals::SIGNAL_NOISE, floor.config.sampleRate, floor.config.numChannels, blockSize * 64);
+            juce::AudioBuffer<float> buffer (floor.config.numChannels, blockSize);
+
+            const int numBlocks = (int) (seconds * floor.config.sampleRate / blockSize);
+            auto start = juce::Time::getMillisecondCounterHiRes();
+            for (int block = 0; block < numBlocks; block++) {
+                for (int channel = 0; channel < buffer.getNumChannels(); ++channel)
+                    buffer.copyFrom (channel, 0, input, channel, (block % 64) * blockSize, blockSize);
+                if (floor.config.numChannels == 2) delay.processPair (buffer, 0, blockSize);
+                else delay.process (buffer, 0, 0, blockSize);
+            }
+            expectRealtimeFactor ((juce::Time::getMillisecondCounterHiRes() - start) / 1000.0, floor.minRealtimeFactor);
+        }
+
+        // processBlock全体 (ゲート, bypassのランプ, visualiserへの受け渡しを含む), stereo
+        // GATE MODE = SIDECHAINはstereoのsidechainを有効にして, 100msごとにゲートが開閉する信号を入れる (envelope followerとブロックの分割を含む)
+        for (bool sidechain : { false, true }) {
+            beginTest (sidechain ? "processBlock stereo48k, sidechain gate" : "processBlock stereo48k");
+
+            REVERSEGATEAudioProcessor processor;
+            if (sidechain) {
+                expect (processor.getBus (true, 1)->enable());
+                auto* gateMode = processor.parameters.getParameter ("GATE MODE");
+                gateMode->setValueNotifyingHost (gateMode->convertTo0to1 (3.0f)); // SIDECHAIN
+            }
+            processor.setRateAndBufferSizeDetails (48000.0, blockSize);
+            processor.prepareToPlay (48000.0, blockSize);
+
+            const int numInputChannels = sidechain ? 4 : 2;
+            auto input = TestSignals::makeSignal (TestSignals::SIGNAL_NOISE, 48000.0, numInputChannels, blockSize * 64);
+            for (int channel = 2; channel < numInputChannels; ++channel)
+                for (int i = 0; i < input.getNumSamples(); i++)
+                    if ((i / 4800) % 2 == 1) input.setSample (channel, i, 0.0f);
+            juce::AudioBuffer<float> buffer (numInputChannels, blockSize);
+            juce::MidiBuffer midi;
+
+            const int numBlocks = (int) (seconds * 48000.0 / blockSize);
+            auto start = juce::Time::getMillisecondCounterHiRes();
+            for (int block = 0; block < numBlocks; block++) {
+                for (int channel = 0; channel < numInputChannels; ++channel)
+                    buffer.copyFrom (channel, 0, input, channel, (block % 64) * blockSize, blockSize);
+                processor.processBlock (buffer, midi);
+            }
+            expectRealtimeFactor ((juce::Time::getMillisecondCounterHiRes() - start) / 1000.0, 20.0);
+            processor.releaseResources();
+        }
+
+        // サーバー用: 同じ設定のstereoストリームN本を, BatchEngine 1つとプラグインN個で比べる
+        // パラメータはどちらもプラグインの初期値 (WIDTH 0, GATE MODE = OFF)
+        // 1 threadでもN個のprocessBlockと同じくらい (tap tableを1回読んでlane全部に足す), threadが増えればその分速くなる
+        // 下限は1 threadの計測のばらつきを見て, processBlockの0.8倍
+        beginTest ("BatchEngine vs processors, " + juce::String (numStreams) + " stereo streams");
+        {
+            auto input = TestSignals::makeSignal (TestSignals::SIGNAL_NOISE, 48000.0, 2, blockSize * 64);
+            const int numBlocks = (int) (streamSeconds * 48000.0 / blockSize);
+
+            std::vector<std::unique_ptr<REVERSEGATEAudioProcessor>> processors;
+            for (int s = 0; s < numStreams; s++) {
+                processors.push_back (std::make_unique<REVERSEGATEAudioProcessor>());
+                processors.back()->setRateAndBufferSizeDetails (48000.0, blockSize);
+                processors.back()->prepareToPlay (48000.0, blockSize);
+            }
+            juce::AudioBuffer<float> buffer (2, blockSize);
+            juce::MidiBuffer midi;
+            auto start = juce::Time::getMillisecondCounterHiRes();
+            for (int block = 0; block < numBlocks; block++) {
+                for (auto& processor : processors) {
+                    for (int channel = 0; channel < 2; ++channel)
+                        buffer.copyFrom (channel, 0, input, channel, (block % 64) * blockSize, blockSize);
+                    processor->processBlock (buffer, midi);
+                }
+            }
+            const double processorSeconds = (juce::Time::getMillisecondCounterHiRes() - start) / 1000.0;
+            for (auto& processor : processors) processor->releaseResources();
+
+            BatchEngine engine (48000.0, blockSize, 50.0f, 500.0f);
+            BatchEngine::StreamParameters parameters;
+            parameters.delayTime = 30.0f;
+            parameters.roomSize = 15.0f;
+            parameters.mix = 50.0f;
+            parameters.volume = 0.8f;
+            std::vector<juce::AudioBuffer<float>> buffers;
+            std::vector<juce::AudioBuffer<float>*> bufferPointers;
+            for (int s = 0; s < numStreams; s++) {
+                engine.addStream (2, parameters);
+                buffers.emplace_back (2, blockSize);
+            }
+            for (auto& b : buffers) bufferPointers.push_back (&b);
+            start = juce::Time::getMillisecondCounterHiRes();
+            for (int block = 0; block < numBlocks; block++) {
+                for (auto& b : buffers)
+                    for (int channel = 0; channel < 2; ++channel)
+                        b.copyFrom (channel, 0, input, channel, (block % 64) * blockSize, blockSize);
+                engine.process (bufferPointers.data(), blockSize);
+            }
+            const double batchSeconds = (juce::Time::getMillisecondCounterHiRes() - start) / 1000.0;
+
+            auto factor = [] (double elapsedSeconds) { return numStreams * streamSeconds / juce::jmax (1.0e-9, elapsedSeconds); };
+            logMessage ("  processors " + juce::String (factor (processorSeconds), 1) + "x realtime, BatchEngine "
+                        + juce::String (factor (batchSeconds), 1) + "x realtime ("
+                        + juce::String (processorSeconds / juce::jmax (1.0e-9, batchSeconds), 2) + "x, "
+                        + juce::String (juce::SystemStats::getNumCpus()) + " threads)");
+            expectGreaterOrEqual (factor (batchSeconds), 0.8 * factor (processorSeconds), "BatchEngine slower than one processor per stream");
+        }
+       #endif
+    }
+
+private:
+    void expectRealtimeFactor (double elapsedSeconds, double minRealtimeFactor)
+    {
+        auto factor = seconds / juce::jmax (1.0e-9, elapsedSeconds);
+        logMessage ("  " + juce::String (factor, 1) + "x realtime (floor " + juce::String (minRealtimeFactor, 1) + "x)");
+        expectGreaterOrEqual (factor, minRealtimeFactor);
+    }
+
+    static constexpr int blockSize = 512;
+    static constexpr double seconds = 20.0;
+    static constexpr int numStreams = 32;
+    static constexpr double streamSeconds = 5.0;   // ストリーム1本あたり
+};
+
+static PerformanceTests performanceTests;
@@ -0,0 +1,72 @@
+/*
+  ==============================================================================
+
+    PresetBankTests.cpp
+
+  ==============================================================================
+*/
+
+#include <JuceHeader.h>
+#include "../Source/PresetBank.h"
+
+// 壊れたプリセットファイルの値がパラメータの範囲外のままprocessorに渡らないか
+class PresetBankTests : public juce::UnitTest
+{
+public:
+    PresetBankTests() : juce::UnitTest ("Preset bank", "State") {}
+
+    void runTest() override
+    {
+        beginTest ("Non-finite and out-of-range file values are repaired");
+
+        const float nan = std::numeric_limits<float>::quiet_NaN();
+        const float inf = std::numeric_limits<float>::infinity();
+        const float entries[][4] =
+        {
+            { 12.0f, 34.0f, 56.0f, 0.5f },  // そのまま
+            { nan,   nan,   nan,   nan  },
+            { inf,   -inf,  inf,   -inf },
+            { -5.0f, 1.0e9f, 250.0f, 7.0f },
+        };
+
+        juce::TemporaryFile file (".rgbank");
+        {
+            juce::FileOutputStream stream (file.getFile());
+            stream.writeInt (0x4b424752); // "RGBK"
+            stream.writeInt (1);
+            stream.writeInt ((int) juce::numElementsInArray (entries));
+            for (auto& values : entries) {
+                char name[32] = "Broken";
+                stream.write (name, sizeof (name));
+                for (auto value : values) stream.writeFloat (value);
+            }
+        }
+
+        PresetBank bank;
+        expect (bank.loadFromFile (file.getFile()));
+        expectEquals (bank.size(), (int) juce::numElementsInArray (entries));
+
+        auto intact = bank.getPreset (0);
+        expectEquals (intact.delayTime, 12.0f);
+        expectEquals (intact.roomSize, 34.0f);
+        expectEquals (intact.mix, 56.0f);
+        expectEquals (intact.volume, 0.5f);
+
+        for (int i = 1; i < bank.size(); i++) {
+            auto preset = bank.getPreset (i);
+            expectWithinRange (preset.delayTime, 0.0f, 50.0f);
+            expectWithinRange (preset.roomSize, 0.0f, 500.0f);
+            expectWithinRange (preset.mix, 0.0f, 100.0f);
+            expectWithinRange (preset.volume, 0.0f, 1.0f);
+        }
+    }
+
+private:
+    void expectWithinRange (float value, float minValue, float maxValue)
+    {
+        expect (std::isfinite (value) && value >= minValue && value <= maxValue,
+                juce::String (value) + " is outside " + juce::String (minValue) + " ~ " + juce::String (maxValue));
+    }
+};
+
+static PresetBankTests presetBankTests;
@@ -0,0 +1,124 @@
+/*
+  ==============================================================================
+
+    QualityTests.cpp
+
+  ==============================================================================
+*/
+
+#include "TestSignals.h"
+
+// QUALITY_REALTIMEとQUALITY_OFFLINEの出力の差が, MultiTapDelay.hに書いてある上限に収まるか
+//   |差[n]| <= mix * volume * Σj g_j * (f_j * |x[n-d_j-1] - x[n-d_j]| + t(x[n-d_j])) + ε
+// wetがクリップしない振幅では, 差そのものが符号付きの和とεの範囲で一致するかも見る
+// (小数部分や補間の相手を間違えれば, 差の大きさが合っていても符号や位置がずれて必ず外れる)
+class QualityTests : public juce::UnitTest
+{
+public:
+    QualityTests() : juce::UnitTest ("Quality tiers error bound", "Quality") {}
+
+    void runTest() override
+    {
+        for (auto config : { TestSignals::getConfigs()[0], TestSignals::getConfigs()[1] }) {
+            for (float amplitude : { 0.5f, 0.1f, 1.0e-3f }) {
+                for (double frequency : { 110.0, 1000.0, 5000.0 }) {
+                    beginTest (juce::String (config.name) + ", " + juce::String (frequency) + " Hz, amplitude " + juce::String (amplitude));
+
+                    const int numSamples = 16384;
+                    auto input = makeSine (config, frequency, amplitude, numSamples);
+
+                    config.quality = MultiTapDelay::QUALITY_REALTIME;
+                    MultiTapDelay::TapTable table;
+                    auto realtime = render (config, input, table);
+                    config.quality = MultiTapDelay::QUALITY_OFFLINE;
+                    auto offline = render (config, input, table);
+
+                    const double gain = config.mix / 100.0 * config.volume;
+                    double maxError = 0.0, maxOverBound = -1.0, maxMismatch = 0.0, largestBound = 0.0;
+                    for (int lane = 0; lane < input.getNumChannels(); ++lane) {
+                        auto volumes = getLaneVolumes (config, table, lane);
+                        double sumVolumes = 0.0;
+                        for (auto volume : volumes) sumVolumes += volume;
+                        const double epsilon = std::pow (2.0, -24.0) * (2 * MultiTapDelay::numTaps + 8) * sumVolumes * amplitude;
+
+                        const float* x = input.getReadPointer (lane);
+                        auto at = [&] (int i) { return i >= 0 ? (double) x[i] : 0.0; }; // setUp()の後なので前は0
+                        for (int n = 0; n < numSamples; n++) {
+                            double bound = 0.0, predicted = 0.0;
+                            for (int j = 0; j < MultiTapDelay::numTaps; j++) {
+                                const int d = table.samples[(size_t) j] + (lane == 1 ? table.laneOffsets[(size_t) j] : 0);
+                                const double f = table.fractions[(size_t) j];
+                                const double near = at (n - d), far = at (n - d - 1);
+                                const double thresholded = std::abs (near) < 1.0e-4 ? near : 0.0;
+                                bound += volumes[(size_t) j] * (f * std::abs (far - near) + std::abs (thresholded));
+                                predicted += volumes[(size_t) j] * (f * (near - far) - thresholded);
+                            }
+                            bound = gain * bound + epsilon;
+                            predicted *= gain;
+
+                            const double error = (double) realtime.getSample (lane, n) - (double) offline.getSample (lane, n);
+                            maxError = juce::jmax (maxError, std::abs (error));
+                            maxOverBound = juce::jmax (maxOverBound, std::abs (error) - bound);
+                            maxMismatch = juce::jmax (maxMismatch, std::abs (error - predicted) - epsilon);
+                            largestBound = juce::jmax (largestBound, bound);
+                        }
+                    }
+
+                    logMessage ("  max error " + juce::String (maxError, 8) + ", largest bound " + juce::String (largestBound, 8));
+                    expectLessOrEqual (maxOverBound, 0.0, "outside the documented bound");
+                    expectGreaterThan (maxError, 0.0, "the tiers should differ at all");
+
+                    // Σj g_j * A < 1ならwetはクリップしない
+                    if (amplitude * maxSumVolumes (config, table) < 1.0)
+                        expectLessOrEqual (maxMismatch, 0.0, "difference doesn't match f_j * (x[n-d_j] - x[n-d_j-1])");
+                }
+            }
+        }
+    }
+
+private:
+    static juce::AudioBuffer<float> makeSine (const TestSignals::Config& config, double frequency, float amplitude, int numSamples)
+    {
+        juce::AudioBuffer<float> buffer (config.numChannels, numSamples);
+        for (int channel = 0; channel < config.numChannels; ++channel)
+            for (int i = 0; i < numSamples; i++)
+                buffer.setSample (channel, i, amplitude * (float) std::sin (juce::MathConstants<double>::twoPi * frequency * (i + channel * 3) / config.sampleRate));
+        return buffer;
+    }
+
+    static juce::AudioBuffer<float> render (const TestSignals::Config& config, const juce::AudioBuffer<float>& input, MultiTapDelay::TapTable& table)
+    {
+        MultiTapDelay delay;
+        TestSignals::setUp (delay, config, 512);
+        table = delay.getTapTable();
+        juce::AudioBuffer<float> buffer (input);
+        TestSignals::process (delay, buffer, 512, 3);
+        return buffer;
+    }
+
+    // kernelと同じfloatの計算: L/Rペアは偶数番目のタップがL寄り, 奇数番目がR寄り (width 100で ±0.5)
+    static std::array<float, MultiTapDelay::numTaps> getLaneVolumes (const TestSignals::Config& config, const MultiTapDelay::TapTable& table, int lane)
+    {
+        std::array<float, MultiTapDelay::numTaps> volumes;
+        const float widthAmount = config.width / 100.0f * 0.5f;
+        for (int j = 0; j < MultiTapDelay::numTaps; j++) {
+            const float spread = (j % 2 == 0) ? widthAmount : -widthAmount;
+            volumes[(size_t) j] = config.numChannels == 1 ? table.volumes[(size_t) j]
+                                                          : table.volumes[(size_t) j] * (lane == 0 ? 1.0f + spread : 1.0f - spread);
+        }
+        return volumes;
+    }
+
+    static double maxSumVolumes (const TestSignals::Config& config, const MultiTapDelay::TapTable& table)
+    {
+        double largest = 0.0;
+        for (int lane = 0; lane < config.numChannels; ++lane) {
+            double sum = 0.0;
+            for (auto volume : getLaneVolumes (config, table, lane)) sum += volume;
+            largest = juce::jmax (largest, sum);
+        }
+        return largest;
+    }
+};
+
+static QualityTests qualityTests;
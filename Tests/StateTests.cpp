@@ -0,0 +1,172 @@
+/*
+  ==============================================================================
+
+    StateTests.cpp
+
+  ==============================================================================
+*/
+
+#include <JuceHeader.h>
+#include "../Source/PluginProcessor.h"
+#include "Tools.h"
+
+// 状態の保存/読み込み: バイナリ形式の往復, パラメータが変わった後の状態の読み込み, 1インスタンスあたりの時間 (旧XML形式との比較)
+// 読み込んだ状態のインパルス応答の書き出し (Main.cppの --export-ir)
+class StateTests : public juce::UnitTest
+{
+public:
+    StateTests() : juce::UnitTest ("Plugin state", "State") {}
+
+    void runTest() override
+    {
+        REVERSEGATEAudioProcessor processor;
+        auto& params = processor.getParameters();
+
+        beginTest ("Binary state round trip");
+        {
+            // 既定値から離れた値にしておく
+            for (auto* param : params)
+                param->setValueNotifyingHost (0.37f);
+            std::vector<float> saved;
+            for (auto* param : params) saved.push_back (param->getValue());
+
+            juce::MemoryBlock state;
+            processor.getStateInformation (state);
+            int idTableSize = 0;
+            for (auto* param : params) idTableSize += (int) static_cast<juce::RangedAudioParameter*> (param)->paramID.getNumBytesAsUTF8() + 1;
+            expectEquals ((int) state.getSize(), 16 + (int) sizeof (float) * params.size() + idTableSize);
+
+            for (auto* param : params) param->setValueNotifyingHost (param->getDefaultValue());
+            processor.setStateInformation (state.getData(), (int) state.getSize());
+            for (int i = 0; i < params.size(); i++)
+                expectWithinAbsoluteError (params[i]->getValue(), saved[(size_t) i], 1.0e-6f, params[i]->getName (32));
+        }
+
+        // IDのハッシュが合わない状態 (パラメータが増えた/減った/並びが変わった) はIDで読む, 知らないIDは飛ばす
+        beginTest ("State with other parameters is read by ID");
+        {
+            auto* mix = processor.parameters.getParameter ("MIX");
+            auto* volume = processor.parameters.getParameter ("VOLUME");
+            auto* width = processor.parameters.getParameter ("WIDTH");
+            mix->setValueNotifyingHost (mix->getDefaultValue());
+            volume->setValueNotifyingHost (volume->getDefaultValue());
+            width->setValueNotifyingHost (0.25f);
+            auto savedWidth = width->getValue();
+
+            juce::MemoryBlock state;
+            {
+                juce::MemoryOutputStream stream (state, false);
+                stream.writeInt (0x52564754);   // "RVGT"
+                stream.writeInt (2);
+                stream.writeInt (3);
+                stream.writeInt (0);            // 今のパラメータのハッシュとは違う
+                stream.writeFloat (0.3f);
+                stream.writeFloat (5.0f);
+                stream.writeFloat (12.0f);
+                stream.writeString ("VOLUME");
+                stream.writeString ("REMOVED");
+                stream.writeString ("MIX");
+            }
+            processor.setStateInformation (state.getData(), (int) state.getSize());
+            expectWithinAbsoluteError (volume->getValue(), volume->convertTo0to1 (0.3f), 1.0e-6f, "VOLUME");
+            expectWithinAbsoluteError (mix->getValue(), mix->convertTo0to1 (12.0f), 1.0e-6f, "MIX");
+            expectWithinAbsoluteError (width->getValue(), savedWidth, 1.0e-6f, "WIDTH is not in the state");
+        }
+
+        // 古い版は木をプラグイン名で保存していた, "REVERSE GATE"はxmlの名前として正しくない
+        beginTest ("Legacy XML state still loads");
+        juce::MemoryBlock xmlState;
+        {
+            auto text = processor.parameters.copyState().createXml()->toString().replace ("REVERSEGATE", "REVERSE GATE");
+            {
+                juce::MemoryOutputStream stream (xmlState, false);
+                stream.writeInt (0x21324356);   // copyXmlToBinary()の形式
+                stream.writeInt ((int) text.getNumBytesAsUTF8());
+                stream.write (text.toRawUTF8(), text.getNumBytesAsUTF8() + 1);
+            }
+            auto* mix = params[2];
+            auto saved = mix->getValue();
+            mix->setValueNotifyingHost (0.0f);
+            processor.setStateInformation (xmlState.getData(), (int) xmlState.getSize());
+            expectWithinAbsoluteError (mix->getValue(), saved, 1.0e-6f);
+        }
+
+        // セッションの読み込み/自動保存で1インスタンスあたりにかかる時間
+        beginTest ("Save/load time per instance");
+        {
+            juce::MemoryBlock state;
+            auto saveMicroseconds = measure ([&] { processor.getStateInformation (state); });
+            auto loadMicroseconds = measure ([&] { processor.setStateInformation (state.getData(), (int) state.getSize()); });
+            auto xmlLoadMicroseconds = measure ([&] { processor.setStateInformation (xmlState.getData(), (int) xmlState.getSize()); });
+            logMessage ("  save " + juce::String (saveMicroseconds, 2) + " us, load " + juce::String (loadMicroseconds, 2)
+                        + " us, legacy xml load " + juce::String (xmlLoadMicroseconds, 2) + " us");
+           #if ! JUCE_DEBUG
+            expectLessThan (loadMicroseconds, xmlLoadMicroseconds, "binary load should be faster than xml");
+           #endif
+        }
+
+        // prepareToPlayの前に読み込んだ値がそのまま応答になるか, 同じ設定のMultiTapDelayと比べる
+        beginTest ("Impulse response follows the loaded state");
+        {
+            REVERSEGATEAudioProcessor source;
+            setValue (source, "DELAY TIME", 40.0f);
+            setValue (source, "ROOM SIZE", 20.0f);
+            setValue (source, "MIX", 40.0f);
+            setValue (source, "VOLUME", 0.5f);
+            setValue (source, "WIDTH", 35.0f);
+            setValue (source, "SYNC", 0.0f);
+            setValue (source, "QUALITY", 1.0f); // REALTIME
+            juce::MemoryBlock state;
+            source.getStateInformation (state);
+
+            juce::TemporaryFile file (".f32");
+            const double sampleRate = 48000.0;
+            expect (Tools::exportImpulseResponse (state, sampleRate, file.getFile()));
+
+            MultiTapDelay reference;
+            reference.setNumLanes (2);
+            reference.setRoomSizeMax (500.0f);
+            reference.setDelayTimeMax (50.0f);
+            reference.prepare ((float) sampleRate, 512);
+            reference.setMix (*source.parameters.getRawParameterValue ("MIX"));
+            reference.setVolume (*source.parameters.getRawParameterValue ("VOLUME"));
+            reference.setWidth (*source.parameters.getRawParameterValue ("WIDTH"));
+            auto table = reference.compileTapTable (*source.parameters.getRawParameterValue ("DELAY TIME"),
+                                                    *source.parameters.getRawParameterValue ("ROOM SIZE"));
+            auto left = reference.getImpulseResponse (table, 0);
+            auto right = reference.getImpulseResponse (table, 1);   // widthのずれの分だけLより長い
+            const size_t length = juce::jmax (left.size(), right.size());
+            left.resize (length, 0.0f);
+            right.resize (length, 0.0f);
+
+            juce::MemoryBlock written;
+            file.getFile().loadFileAsData (written);
+            expectEquals ((int) written.getSize(), (int) (length * 2 * sizeof (float)));
+            juce::MemoryInputStream stream (written, false);
+            float maxError = 0.0f;
+            for (size_t i = 0; i < length && ! stream.isExhausted(); i++) {
+                maxError = juce::jmax (maxError, std::abs (stream.readFloat() - left[i]));
+                maxError = juce::jmax (maxError, std::abs (stream.readFloat() - right[i]));
+            }
+            expectLessOrEqual (maxError, 1.0e-6f);
+        }
+    }
+
+private:
+    static void setValue (REVERSEGATEAudioProcessor& processor, const juce::String& parameterID, float value)
+    {
+        auto* param = processor.parameters.getParameter (parameterID);
+        param->setValueNotifyingHost (param->convertTo0to1 (value));
+    }
+
+    template <typename Function>
+    static double measure (Function&& function)
+    {
+        const int iterations = 2000;
+        auto start = juce::Time::getMillisecondCounterHiRes();
+        for (int i = 0; i < iterations; i++) function();
+        return (juce::Time::getMillisecondCounterHiRes() - start) * 1000.0 / iterations;
+    }
+};
+
+static StateTests stateTests;
@@ -0,0 +1,60 @@
+/*
+  ==============================================================================
+
+    TempoTapTablesTests.cpp
+
+  ==============================================================================
+*/
+
+#include <JuceHeader.h>
+#include "../Source/TempoTapTables.h"
+
+// SYNC用のtap table: enable()までは何も作らない, 音符を変えたらworker threadが作り直す
+class TempoTapTablesTests : public juce::UnitTest
+{
+public:
+    TempoTapTablesTests() : juce::UnitTest ("Tempo tap tables", "Sync") {}
+
+    void runTest() override
+    {
+        beginTest ("Note choices are limited to reachable lengths");
+        {
+            // 1/16は300BPMでちょうど50ms, それより長い音符はDELAY TIMEの上限に丸められるだけ
+            expectEquals (TempoTapTables::getNoteNames (50.0f).size(), 4);
+            expectEquals (TempoTapTables::getNoteNames (500.0f).size(), 7);
+        }
+
+        beginTest ("Nothing is built until enabled");
+        TempoTapTables tables;
+        juce::int64 key = -1;
+        MultiTapDelay::TapTable table;
+        {
+            tables.setNotes (2, 2);
+            tables.prepare (48000.0, 50.0f, 500.0f);
+            expect (! tables.getTapTableIfChanged (120.0, key, table));
+        }
+
+        beginTest ("Enabling builds, a note change rebuilds");
+        {
+            tables.enable();
+            expect (waitForTable (tables, key, table));
+            expectWithinAbsoluteError (table.delayTime, 4.0f / 64.0f * 500.0f, 1.0e-3f); // 1/64 @ 120BPM
+
+            tables.setNotes (0, 2);
+            expect (waitForTable (tables, key, table));
+            expectWithinAbsoluteError (table.delayTime, 4.0f / 256.0f * 500.0f, 1.0e-3f);
+        }
+    }
+
+private:
+    static bool waitForTable (TempoTapTables& tables, juce::int64& key, MultiTapDelay::TapTable& table)
+    {
+        for (int i = 0; i < 500; i++) {
+            if (tables.getTapTableIfChanged (120.0, key, table)) return true;
+            juce::Thread::sleep (10);
+        }
+        return false;
+    }
+};
+
+static TempoTapTablesTests tempoTapTablesTests;
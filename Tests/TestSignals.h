@@ -0,0 +1,177 @@
+/*
+  ==============================================================================
+
+    TestSignals.h
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+#include "../Source/MultiTapDelay.h"
+
+// テスト用の決まった入力信号と設定, MultiTapDelayで鳴らす処理
+// 参照出力 (References/*.f32) はこれで作る, 信号か設定を変えたら --write-references で作り直す
+namespace TestSignals
+{
+    // どの環境でも同じ列になる乱数 (xorshift32), -1~1
+    class Noise
+    {
+    public:
+        explicit Noise (juce::uint32 seed) : state (seed == 0 ? 1 : seed) {}
+
+        juce::uint32 nextInt()
+        {
+            state ^= state << 13;
+            state ^= state >> 17;
+            state ^= state << 5;
+            return state;
+        }
+        float nextFloat() { return (float) ((double) nextInt() / 4294967296.0 * 2.0 - 1.0); }
+
+    private:
+        juce::uint32 state;
+    };
+
+    //==============================================================================
+    enum Signal
+    {
+        SIGNAL_IMPULSE = 0,
+        SIGNAL_SWEEP,
+        SIGNAL_NOISE,
+        numSignals
+    };
+
+    inline const char* getSignalName (int signal)
+    {
+        const char* names[] = { "impulse", "sweep", "noise" };
+        return names[signal];
+    }
+
+    // チャンネルごとに少し変えておく (L/Rペアの取り違えが分かるように)
+    inline juce::AudioBuffer<float> makeSignal (int signal, double sampleRate, int numChannels, int numSamples)
+    {
+        juce::AudioBuffer<float> buffer (numChannels, numSamples);
+        buffer.clear();
+        for (int channel = 0; channel < numChannels; ++channel) {
+            auto* data = buffer.getWritePointer (channel);
+            if (signal == SIGNAL_IMPULSE) {
+                data[channel * 17] = 1.0f;
+            }
+            else if (signal == SIGNAL_SWEEP) {
+                // 20Hz~fs/2.2の対数スイープ
+                const double f0 = 20.0, f1 = sampleRate / 2.2, duration = numSamples / sampleRate;
+                const double k = std::log (f1 / f0);
+                for (int i = 0; i < numSamples; i++) {
+                    const double t = i / sampleRate;
+                    const double phase = juce::MathConstants<double>::twoPi * f0 * duration / k * (std::exp (t / duration * k) - 1.0);
+                    data[i] = (float) (0.5 * std::sin (phase + channel * 0.5));
+                }
+            }
+            else {
+                Noise noise ((juce::uint32) (1234 + channel));
+                for (int i = 0; i < numSamples; i++) data[i] = 0.5f * noise.nextFloat();
+            }
+        }
+        return buffer;
+    }
+
+    //==============================================================================
+    struct Config
+    {
+        const char* name;
+        double sampleRate;
+        int numChannels;    // 2 = processPair()
+        float delayTime;
+        float roomSize;
+        float mix;
+        float volume;
+        float width;
+        MultiTapDelay::Quality quality;
+        bool linear;
+    };
+
+    inline const std::vector<Config>& getConfigs()
+    {
+        static const std::vector<Config> configs =
+        {
+            { "mono44k",          44100.0, 1, 30.0f, 15.0f,  50.0f, 0.8f,  0.0f, MultiTapDelay::QUALITY_REALTIME, false },
+            { "pair48k",          48000.0, 2,  5.0f,  4.0f, 100.0f, 1.0f, 60.0f, MultiTapDelay::QUALITY_REALTIME, false },
+            { "mono96k_offline",  96000.0, 1, 12.5f, 7.25f, 70.0f, 0.7f,  0.0f, MultiTapDelay::QUALITY_OFFLINE,  false },
+            { "pair88k_linear",   88200.0, 2, 20.0f, 10.0f, 80.0f, 0.9f, 30.0f, MultiTapDelay::QUALITY_OFFLINE,  true  },
+        };
+        return configs;
+    }
+
+    // 設定どおりのMultiTapDelayを用意する, tap tableのクロスフェードと
+    // サンプルレート変更のフェード (44.1k以外ではprepare()で始まる) が終わるまで無音を流しておく
+    inline void setUp (MultiTapDelay& delay, const Config& config, int maxBlockSize)
+    {
+        delay.setNumLanes (config.numChannels);
+        delay.setRoomSizeMax (500.0f);
+        delay.setDelayTimeMax (50.0f);
+        delay.prepare ((float) config.sampleRate, maxBlockSize);
+        delay.setQuality (config.quality);
+        delay.setLinear (config.linear);
+        delay.setMix (config.mix);
+        delay.setVolume (config.volume);
+        delay.setWidth (config.width);
+        delay.switchTapTable (delay.compileTapTable (config.delayTime, config.roomSize));
+
+        juce::AudioBuffer<float> silence (config.numChannels, maxBlockSize);
+        for (int done = 0, settle = (int) (0.05 * config.sampleRate) + 1; done < settle || delay.getFadeState() != 0; done += maxBlockSize) {
+            silence.clear();
+            if (config.numChannels == 2) delay.processPair (silence, 0, maxBlockSize);
+            else delay.process (silence, 0, 0, maxBlockSize);
+        }
+    }
+
+    // 1~maxBlockSizeのばらばらなブロック長で処理する (長さの列はblockSeedで決まる)
+    inline void process (MultiTapDelay& delay, juce::AudioBuffer<float>& buffer, int maxBlockSize, juce::uint32 blockSeed)
+    {
+        Noise blockSizes (blockSeed);
+        for (int start = 0; start < buffer.getNumSamples();) {
+            const int n = juce::jmin (buffer.getNumSamples() - start, 1 + (int) (blockSizes.nextInt() % (juce::uint32) maxBlockSize));
+            if (buffer.getNumChannels() == 2) delay.processPair (buffer, start, n);
+            else delay.process (buffer, 0, start, n);
+            start += n;
+        }
+    }
+
+    // 一番遠いタップ (サンプル), QUALITY_OFFLINEで1サンプル古い方とL/RペアのRのずれも読む分を含む
+    // 入力が止まってからこれだけ経てば出力はちょうど0
+    inline int getLongestTap (const MultiTapDelay& delay)
+    {
+        const auto& table = delay.getTapTable();
+        int longestTap = 0;
+        for (int j = 0; j < MultiTapDelay::numTaps; j++)
+            longestTap = juce::jmax (longestTap, table.samples[(size_t) j] + table.laneOffsets[(size_t) j]);
+        return longestTap + 1;
+    }
+
+    // 参照出力の入力はsignalLengthだけ, その後は一番遠いタップ + tailLengthまで無音を流す
+    // (全部のタップの出力と, 0に戻った所まで参照に入る)
+    static constexpr int signalLength = 4096;
+    static constexpr int tailLength = 256;
+
+    inline juce::AudioBuffer<float> render (const Config& config, int signal)
+    {
+        const int maxBlockSize = 700;
+        MultiTapDelay delay;
+        setUp (delay, config, maxBlockSize);
+
+        auto input = makeSignal (signal, config.sampleRate, config.numChannels, signalLength);
+        juce::AudioBuffer<float> buffer (config.numChannels, signalLength + getLongestTap (delay) + tailLength);
+        buffer.clear();
+        for (int channel = 0; channel < buffer.getNumChannels(); ++channel)
+            buffer.copyFrom (channel, 0, input, channel, 0, signalLength);
+        process (delay, buffer, maxBlockSize, 99);
+        return buffer;
+    }
+
+    // References/<config>_<signal>.f32 : 32-bit float, little endian, チャンネル交互
+    inline juce::String getReferenceName (const Config& config, int signal)
+    {
+        return juce::String (config.name) + "_" + getSignalName (signal) + ".f32";
+    }
+}
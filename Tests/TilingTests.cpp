@@ -0,0 +1,92 @@
+/*
+  ==============================================================================
+
+    TilingTests.cpp
+
+  ==============================================================================
+*/
+
+#include "TestSignals.h"
+
+// 大きなホストブロック (内部ではtileSizeごとに処理) と, 1サンプルずつの処理が
+// ビット単位で同じ出力になるか確かめる
+// 途中でゲートの開閉, tap tableの切り替え, mix/volume/widthの変更を挟む (プラグインのMIDIイベントと同じくブロックを区切って渡す)
+class TilingTests : public juce::UnitTest
+{
+public:
+    TilingTests() : juce::UnitTest ("Tiling matches one sample at a time", "Tiling") {}
+
+    void runTest() override
+    {
+        for (auto& config : TestSignals::getConfigs()) {
+            const int numSamples = (int) (config.sampleRate * 2.0);
+            auto reference = render (config, numSamples, 1);
+
+            for (int hostBlockSize : { 777, 4096, 16384 }) {
+                beginTest (juce::String (config.name) + ", host block " + juce::String (hostBlockSize));
+                auto output = render (config, numSamples, hostBlockSize);
+
+                int mismatches = 0;
+                for (int channel = 0; channel < config.numChannels; ++channel)
+                    for (int i = 0; i < numSamples; i++)
+                        if (std::memcmp (output.getReadPointer (channel) + i, reference.getReadPointer (channel) + i, sizeof (float)) != 0)
+                            mismatches++;
+                expectEquals (mismatches, 0);
+            }
+        }
+    }
+
+private:
+    // 入力信号のサンプル位置で起こすイベント
+    struct Event
+    {
+        double seconds;
+        std::function<void (MultiTapDelay&)> apply;
+    };
+
+    static std::vector<Event> getEvents (const TestSignals::Config& config)
+    {
+        return
+        {
+            { 0.25, [] (MultiTapDelay& delay) { delay.setGate (false, false); } },
+            { 0.40, [] (MultiTapDelay& delay) { delay.setGate (true, true); } },
+            { 0.55, [&config] (MultiTapDelay& delay) { delay.switchTapTable (delay.compileTapTable (config.delayTime * 0.5f, config.roomSize * 1.5f)); } },
+            { 0.57, [] (MultiTapDelay& delay) { delay.setMix (35.0f); } },
+            { 0.90, [] (MultiTapDelay& delay) { delay.setVolume (0.6f); delay.setWidth (90.0f); } },
+            { 1.20, [&config] (MultiTapDelay& delay) { delay.switchTapTable (delay.compileTapTable (config.delayTime, config.roomSize)); } },
+            { 1.21, [] (MultiTapDelay& delay) { delay.setGate (false, false); } },
+            { 1.23, [] (MultiTapDelay& delay) { delay.setGate (true, false); } },
+        };
+    }
+
+    // hostBlockSize == 1 なら1サンプルずつ
+    static juce::AudioBuffer<float> render (const TestSignals::Config& config, int numSamples, int hostBlockSize)
+    {
+        MultiTapDelay delay;
+        TestSignals::setUp (delay, config, hostBlockSize);
+
+        // ノイズの合間に無音を挟む (historyが全部0の間の読み飛ばしも通す)
+        auto buffer = TestSignals::makeSignal (TestSignals::SIGNAL_NOISE, config.sampleRate, config.numChannels, numSamples);
+        for (int channel = 0; channel < config.numChannels; ++channel)
+            buffer.clear (channel, numSamples / 2, numSamples / 8);
+
+        auto events = getEvents (config);
+        size_t nextEvent = 0;
+        for (int blockStart = 0; blockStart < numSamples; blockStart += hostBlockSize) {
+            const int blockEnd = juce::jmin (numSamples, blockStart + hostBlockSize);
+            for (int start = blockStart; start < blockEnd;) {
+                while (nextEvent < events.size() && (int) (events[nextEvent].seconds * config.sampleRate) <= start)
+                    events[nextEvent++].apply (delay);
+                int end = blockEnd;
+                if (nextEvent < events.size())
+                    end = juce::jmin (end, (int) (events[nextEvent].seconds * config.sampleRate));
+                if (config.numChannels == 2) delay.processPair (buffer, start, end - start);
+                else delay.process (buffer, 0, start, end - start);
+                start = end;
+            }
+        }
+        return buffer;
+    }
+};
+
+static TilingTests tilingTests;
@@ -0,0 +1,28 @@
+/*
+  ==============================================================================
+
+    Tools.cpp
+
+  ==============================================================================
+*/
+
+#include "Tools.h"
+#include "../Source/PluginProcessor.h"
+
+bool Tools::exportImpulseResponse (const juce::MemoryBlock& state, double sampleRate, const juce::File& file)
+{
+    const int blockSize = 512;
+    REVERSEGATEAudioProcessor processor;
+    processor.setStateInformation (state.getData(), (int) state.getSize());
+    processor.setRateAndBufferSizeDetails (sampleRate, blockSize);
+    processor.prepareToPlay (sampleRate, blockSize);
+
+    juce::AudioBuffer<float> silence (juce::jmax (processor.getTotalNumInputChannels(), processor.getTotalNumOutputChannels()), blockSize);
+    silence.clear();
+    juce::MidiBuffer midi;
+    processor.processBlock (silence, midi);
+
+    auto written = processor.exportImpulseResponse (file);
+    processor.releaseResources();
+    return written;
+}
@@ -0,0 +1,18 @@
+/*
+  ==============================================================================
+
+    Tools.h
+
+  ==============================================================================
+*/
+
+#pragma once
+#include <JuceHeader.h>
+
+// Main.cppのコマンドとテストが共通で使うツール
+namespace Tools
+{
+    // getStateInformation()で保存した状態を読み込んだprocessorのインパルス応答を書き出す (--export-ir)
+    // プラグインと同じ順番: 状態の読み込み -> prepareToPlay -> 1ブロック (SYNCならここでテンポのtap tableに切り替わる)
+    bool exportImpulseResponse (const juce::MemoryBlock& state, double sampleRate, const juce::File& file);
+}